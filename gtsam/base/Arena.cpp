@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Arena.cpp
+ * @brief   A monotonic arena for short-lived objects, reset in one go
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/base/Arena.h>
+
+#include <cstdint>
+
+namespace gtsam {
+
+static thread_local Arena* currentArena = nullptr;
+
+/* ************************************************************************* */
+Arena::Arena(size_t blockSize)
+    : storage_(std::make_shared<Storage>(blockSize)) {}
+
+/* ************************************************************************* */
+void* Arena::allocate(size_t bytes, size_t alignment) {
+  return storage_->allocate(bytes, alignment);
+}
+
+/* ************************************************************************* */
+void Arena::deallocate(void*, size_t) noexcept { storage_->deallocate(); }
+
+/* ************************************************************************* */
+size_t Arena::liveAllocations() const { return storage_->live_; }
+
+/* ************************************************************************* */
+void* Arena::Storage::allocate(size_t bytes, size_t alignment) {
+  for (;;) {
+    if (current_ < blocks_.size()) {
+      const Block& block = blocks_[current_];
+      const uintptr_t begin = reinterpret_cast<uintptr_t>(block.data.get());
+      const uintptr_t aligned =
+          (begin + offset_ + alignment - 1) & ~uintptr_t(alignment - 1);
+      const size_t start = aligned - begin;
+      if (start + bytes <= block.size) {
+        offset_ = start + bytes;
+        ++live_;
+        return block.data.get() + start;
+      }
+      if (current_ + 1 < blocks_.size()) {
+        ++current_;
+        offset_ = 0;
+        continue;
+      }
+    }
+    // Out of space: add a block large enough for this allocation
+    const size_t size = std::max(blockSize_, bytes + alignment);
+    blocks_.push_back(Block{std::unique_ptr<char[]>(new char[size]), size});
+    current_ = blocks_.size() - 1;
+    offset_ = 0;
+  }
+}
+
+/* ************************************************************************* */
+bool Arena::reset() {
+  Storage& storage = *storage_;
+  if (storage.live_ != 0) return false;
+  if (storage.blocks_.size() > 1) {
+    const size_t size = capacity();
+    storage.blocks_.clear();
+    storage.blocks_.push_back(
+        Storage::Block{std::unique_ptr<char[]>(new char[size]), size});
+  }
+  storage.current_ = 0;
+  storage.offset_ = 0;
+  return true;
+}
+
+/* ************************************************************************* */
+size_t Arena::used() const {
+  const Storage& storage = *storage_;
+  size_t result = storage.offset_;
+  for (size_t i = 0; i < storage.current_ && i < storage.blocks_.size(); ++i)
+    result += storage.blocks_[i].size;
+  return result;
+}
+
+/* ************************************************************************* */
+size_t Arena::capacity() const {
+  size_t result = 0;
+  for (const Storage::Block& block : storage_->blocks_) result += block.size;
+  return result;
+}
+
+/* ************************************************************************* */
+Arena* Arena::Current() { return currentArena; }
+
+/* ************************************************************************* */
+ArenaScope::ArenaScope(Arena* arena) : previous_(currentArena) {
+  currentArena = arena;
+}
+
+/* ************************************************************************* */
+ArenaScope::~ArenaScope() { currentArena = previous_; }
+
+}  // namespace gtsam
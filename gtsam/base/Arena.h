@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Arena.h
+ * @brief   A monotonic arena for short-lived objects, reset in one go
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/dllexport.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A monotonic memory arena: allocation bumps a pointer in a large block, and
+ * deallocation only decrements a count of live allocations.  Once all
+ * objects are gone, reset() makes the whole memory available again, without
+ * returning it to the system.
+ *
+ * An arena is made the current arena of a thread with an ArenaScope, after
+ * which allocateShared() creates objects (and their shared_ptr control block)
+ * in it.  Nonlinear optimizers use this to allocate the linear factors,
+ * conditionals and cliques of one iteration, see
+ * NonlinearOptimizerParams::useArena.  Other threads, e.g. TBB or ThreadPool
+ * workers, keep using the regular heap.
+ *
+ * Objects may be released from any thread, but only the thread of the scope
+ * allocates.  The memory of the arena is shared with the allocators of the
+ * objects created by allocateShared(), such that it stays valid until the last
+ * of them is released, even if the arena is destroyed before.
+ * @addtogroup base
+ */
+class GTSAM_EXPORT Arena {
+ public:
+  /// The blocks of an arena and its count of live allocations
+  class Storage;
+
+  /// Create an empty arena that allocates blocks of at least blockSize bytes
+  explicit Arena(size_t blockSize = 1 << 16);
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /// Allocate \c bytes aligned to \c alignment, a power of two
+  void* allocate(size_t bytes, size_t alignment);
+
+  /// Release an allocation, its memory is only reclaimed by reset()
+  void deallocate(void*, size_t) noexcept;
+
+  /**
+   * Make all memory available again if there are no live allocations, and
+   * merge the blocks into one large enough for the same usage.
+   * @return false, without doing anything, if allocations are still live
+   */
+  bool reset();
+
+  /// Number of allocations not yet released
+  size_t liveAllocations() const;
+
+  /// Number of bytes handed out since the last reset, including padding
+  size_t used() const;
+
+  /// Total size of the blocks owned by the arena
+  size_t capacity() const;
+
+  /// The memory of the arena, shared with the allocators of its objects
+  const std::shared_ptr<Storage>& storage() const { return storage_; }
+
+  /// The current arena of the calling thread, or null if there is none
+  static Arena* Current();
+
+ private:
+  std::shared_ptr<Storage> storage_;
+};
+
+/**
+ * The memory of an Arena: allocation bumps a pointer in the current block.
+ * @addtogroup base
+ */
+class GTSAM_EXPORT Arena::Storage {
+ public:
+  explicit Storage(size_t blockSize)
+      : current_(0), offset_(0), blockSize_(blockSize), live_(0) {}
+
+  Storage(const Storage&) = delete;
+  Storage& operator=(const Storage&) = delete;
+
+  /// Allocate \c bytes aligned to \c alignment, a power of two
+  void* allocate(size_t bytes, size_t alignment);
+
+  /// Release an allocation
+  void deallocate() noexcept { --live_; }
+
+ private:
+  friend class Arena;
+
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+  std::vector<Block> blocks_;
+  size_t current_;  ///< Block being filled
+  size_t offset_;   ///< Next free byte in the current block
+  size_t blockSize_;
+  std::atomic<size_t> live_;
+};
+
+/**
+ * Makes an arena the current arena of the calling thread while in scope,
+ * restoring the previous one (possibly none) on destruction.
+ * @addtogroup base
+ */
+class GTSAM_EXPORT ArenaScope {
+ public:
+  /// Make \c arena current, a null arena disables arena allocation
+  explicit ArenaScope(Arena* arena);
+  ~ArenaScope();
+
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+ private:
+  Arena* previous_;
+};
+
+/**
+ * A standard allocator drawing from an Arena.  It keeps the memory of the
+ * arena alive, e.g. within the control block of a shared_ptr.
+ * @addtogroup base
+ */
+template <class T>
+class ArenaAllocator {
+ public:
+  typedef T value_type;
+
+  explicit ArenaAllocator(Arena* arena) noexcept : storage_(arena->storage()) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : storage_(other.storage()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(storage_->allocate(
+        n * sizeof(T), std::max(alignof(T), alignof(std::max_align_t))));
+  }
+
+  void deallocate(T*, size_t) noexcept { storage_->deallocate(); }
+
+  const std::shared_ptr<Arena::Storage>& storage() const noexcept {
+    return storage_;
+  }
+
+ private:
+  std::shared_ptr<Arena::Storage> storage_;
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+  return a.storage() == b.storage();
+}
+
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+  return a.storage() != b.storage();
+}
+
+/**
+ * Like boost::make_shared, but creates the object in the current arena of the
+ * calling thread, if any.
+ */
+template <class T, class... Args>
+boost::shared_ptr<T> allocateShared(Args&&... args) {
+  if (Arena* arena = Arena::Current())
+    return boost::allocate_shared<T>(ArenaAllocator<T>(arena),
+                                     std::forward<Args>(args)...);
+  return boost::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace gtsam
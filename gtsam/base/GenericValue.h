@@ -127,6 +127,17 @@ public:
       return resultAsValue;
     }
 
+    /// Generic Value interface version of retract, for contiguous storage
+    virtual Value* retract_(const double* delta) const {
+      // A fixed-size tangent vector is mapped onto the stack, not the heap
+      typedef typename traits<T>::TangentVector TangentVector;
+      const T retractResult = traits<T>::Retract(GenericValue<T>::value(),
+          TangentVector(Eigen::Map<const TangentVector>(delta, dim())));
+      void* resultAsValuePlace =
+          boost::singleton_pool<PoolTag, sizeof(GenericValue)>::malloc();
+      return new (resultAsValuePlace) GenericValue(retractResult);
+    }
+
     /// Generic Value interface version of localCoordinates
     virtual Vector localCoordinates_(const Value& value2) const {
       // Cast the base class Value pointer to a templated generic class pointer
@@ -20,6 +20,7 @@
 #include <gtsam/base/timing.h>
 #include <gtsam/base/Vector.h>
 #include <gtsam/base/FastList.h>
+#include <gtsam/base/ThreadPool.h>
 #include <Eigen/SVD>
 #include <Eigen/LU>
 
@@ -628,7 +629,9 @@ std::string formatMatrixIndented(const std::string& label, const Matrix& matrix,
 }
 
 /* ************************************************************************* */
-void inplace_QR(Matrix& A){
+namespace {
+// Blocked Householder QR of all rows at once
+void householderQR(Matrix& A) {
   size_t rows = A.rows();
   size_t cols = A.cols();
   size_t size = std::min(rows,cols);
@@ -646,5 +649,52 @@ void inplace_QR(Matrix& A){
 
   zeroBelowDiagonal(A);
 }
+}  // namespace
+
+/* ************************************************************************* */
+void inplace_QR(Matrix& A){
+  const size_t rows = A.rows();
+  const size_t cols = A.cols();
+  const size_t chunkRows = std::max<size_t>(4 * cols, 256);
+  if (rows < 2 * chunkRows) {
+    householderQR(A);
+    return;
+  }
+
+  // Tall and skinny, e.g. the stacked factors of a large front: factor blocks
+  // of rows independently, in parallel if enabled, and then their stacked R
+  // factors.  R is the same up to the signs of its rows.
+  gttic(inplace_QR_tall);
+  const size_t nrChunks = (rows + chunkRows - 1) / chunkRows;
+  std::vector<Matrix> R(nrChunks);
+  auto factorChunks = [&](size_t begin, size_t end) {
+    for (size_t k = begin; k < end; ++k) {
+      const size_t start = k * chunkRows;
+      const size_t n = std::min(chunkRows, rows - start);
+      Matrix chunk = A.middleRows(start, n);
+      householderQR(chunk);
+      R[k] = chunk.topRows(std::min(n, cols));
+    }
+  };
+#ifdef GTSAM_USE_THREAD_POOL
+  ThreadPool::Global().parallelFor(0, nrChunks, factorChunks, 1);
+#else
+  factorChunks(0, nrChunks);
+#endif
+
+  size_t stackedRows = 0;
+  for (const Matrix& Rk : R) stackedRows += Rk.rows();
+  Matrix stacked(stackedRows, cols);
+  size_t row = 0;
+  for (const Matrix& Rk : R) {
+    stacked.middleRows(row, Rk.rows()) = Rk;
+    row += Rk.rows();
+  }
+  inplace_QR(stacked);
+
+  const size_t rank = std::min(stackedRows, cols);
+  A.topRows(rank) = stacked.topRows(rank);
+  A.bottomRows(rows - rank).setZero();
+}
 
 } // namespace gtsam
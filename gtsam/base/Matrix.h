@@ -296,6 +296,8 @@ GTSAM_EXPORT std::pair<Matrix,Matrix> qr(const Matrix& A);
 
 /**
  * QR factorization using Eigen's internal block QR algorithm
+ * Tall and skinny matrices are factored block of rows by block of rows, in
+ * parallel when GTSAM is built with the thread pool (TSQR).
  * @param A is the input matrix, and is the output
  * @param clear_below_diagonal enables zeroing out below diagonal
  */
@@ -25,6 +25,7 @@
 #include <cassert>
 #include <stdexcept>
 #include <array>
+#include <vector>
 
 namespace boost {
 namespace serialization {
@@ -239,6 +240,71 @@ namespace gtsam {
       }
     }
 
+    /**
+     * Add A'A for the augmented Jacobian Ab = [A_0 ... A_{n-1} b], in which
+     * every variable block A_j has D columns, to the blocks slots[0..n] of this
+     * matrix, the last slot being the one of b.  All blocks are fixed-size, so
+     * the products are computed without temporaries, and blocks are scattered
+     * in one pass; see JacobianFactor::updateHessian.
+     */
+    template <int D, typename MATRIX>
+    void updateFromAugmentedJacobian(const MATRIX& Ab,
+                                     const std::vector<DenseIndex>& slots) {
+      typedef Eigen::Matrix<double, D, D> MatrixD;
+      const DenseIndex n = slots.size() - 1, m = Ab.rows();
+      assert(Ab.cols() == n * D + 1);
+      const auto b = Ab.col(n * D);
+      const DenseIndex bOffset = offset(slots[n]);
+      for (DenseIndex j = 0; j < n; ++j) {
+        const auto Aj = Ab.template block<Eigen::Dynamic, D>(0, j * D, m, D);
+        const DenseIndex J = offset(slots[j]);
+        for (DenseIndex i = 0; i < j; ++i) {
+          const auto Ai = Ab.template block<Eigen::Dynamic, D>(0, i * D, m, D);
+          const DenseIndex I = offset(slots[i]);
+          if (I < J)
+            matrix_.template block<D, D>(I, J).noalias() += Ai.transpose() * Aj;
+          else
+            matrix_.template block<D, D>(J, I).noalias() += Aj.transpose() * Ai;
+        }
+        MatrixD AjAj;
+        AjAj.noalias() = Aj.transpose() * Aj;
+        matrix_.template block<D, D>(J, J).template triangularView<Eigen::Upper>() +=
+            AjAj;
+        matrix_.template block<D, 1>(J, bOffset).noalias() += Aj.transpose() * b;
+      }
+      matrix_(bOffset, bOffset) += b.squaredNorm();
+    }
+
+    /**
+     * Add the upper triangle of \c other, in which every block but the last
+     * one has D rows and columns, to the blocks slots[0..n] of this matrix, as
+     * updateFromAugmentedJacobian; see HessianFactor::updateHessian.
+     */
+    template <int D>
+    void updateFromSymmetric(const SymmetricBlockMatrix& other,
+                             const std::vector<DenseIndex>& slots) {
+      const DenseIndex n = slots.size() - 1;
+      assert(other.nBlocks() == n + 1);
+      const DenseIndex b = other.offset(n), bOffset = offset(slots[n]);
+      for (DenseIndex j = 0; j < n; ++j) {
+        const DenseIndex Jo = other.offset(j), J = offset(slots[j]);
+        for (DenseIndex i = 0; i < j; ++i) {
+          const DenseIndex Io = other.offset(i), I = offset(slots[i]);
+          if (I < J)
+            matrix_.template block<D, D>(I, J) +=
+                other.matrix_.template block<D, D>(Io, Jo);
+          else
+            matrix_.template block<D, D>(J, I) +=
+                other.matrix_.template block<D, D>(Io, Jo).transpose();
+        }
+        matrix_.template block<D, D>(J, J).template triangularView<Eigen::Upper>() +=
+            other.matrix_.template block<D, D>(Jo, Jo);
+        matrix_.template block<D, 1>(J, bOffset) +=
+            other.matrix_.template block<D, 1>(Jo, b);
+      }
+      matrix_(bOffset, bOffset) += other.matrix_(b, b);
+    }
+
     /// @}
     /// @name Accessing the full matrix.
     /// @{
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ThreadPool.cpp
+ * @brief   A portable std::thread pool, used for parallelism without TBB
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/base/ThreadPool.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+ThreadPool::ThreadPool(size_t numThreads) : lastGroup_(0), stop_(false) {
+  if (numThreads == 0)
+    numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  workers_.reserve(numThreads - 1);
+  for (size_t i = 1; i < numThreads; ++i)
+    workers_.emplace_back(&ThreadPool::work, this);
+}
+
+/* ************************************************************************* */
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+
+  // Without workers, queued tasks are run here
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!tasks_.empty()) run(tasks_.begin(), lock);
+}
+
+/* ************************************************************************* */
+void ThreadPool::schedule(Task task, Group group) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.emplace_back(group, std::move(task));
+  }
+  condition_.notify_all();
+}
+
+/* ************************************************************************* */
+void ThreadPool::run(std::deque<std::pair<Group, Task> >::iterator it,
+                     std::unique_lock<std::mutex>& lock) {
+  Task task = std::move(it->second);
+  tasks_.erase(it);
+  lock.unlock();
+  task();
+  lock.lock();
+  // Wake up threads waiting for a result, as well as idle workers
+  condition_.notify_all();
+}
+
+/* ************************************************************************* */
+void ThreadPool::work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+    if (tasks_.empty()) return;  // stopped and nothing left to do
+    run(tasks_.begin(), lock);
+  }
+}
+
+/* ************************************************************************* */
+void ThreadPool::waitUntil(const std::function<bool()>& done, Group group) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!done()) {
+    auto it = std::find_if(
+        tasks_.begin(), tasks_.end(),
+        [group](const std::pair<Group, Task>& task) { return task.first == group; });
+    if (it != tasks_.end())
+      run(it, lock);
+    else
+      condition_.wait(lock);
+  }
+}
+
+/* ************************************************************************* */
+namespace {
+std::mutex globalPoolMutex;
+std::unique_ptr<ThreadPool> globalPool;
+}  // namespace
+
+/* ************************************************************************* */
+ThreadPool& ThreadPool::Global() {
+  std::lock_guard<std::mutex> lock(globalPoolMutex);
+  if (!globalPool) globalPool.reset(new ThreadPool());
+  return *globalPool;
+}
+
+/* ************************************************************************* */
+void ThreadPool::SetGlobalNumThreads(size_t numThreads) {
+  std::lock_guard<std::mutex> lock(globalPoolMutex);
+  globalPool.reset(new ThreadPool(numThreads));
+}
+
+}  // namespace gtsam
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ThreadPool.h
+ * @brief   A portable std::thread pool, used for parallelism without TBB
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/dllexport.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A fixed-size pool of std::threads executing queued tasks. When GTSAM is not
+ * compiled with TBB, the global pool is used to parallelize
+ * NonlinearFactorGraph::linearize, NonlinearFactorGraph::error and
+ * treeTraversal::DepthFirstForestParallel (and hence multifrontal elimination
+ * and back-substitution).
+ *
+ * A pool with N threads starts N-1 workers: the thread that waits for the
+ * results, in waitUntil or parallelFor, executes queued tasks as well. Waiting
+ * from within a task is therefore safe and does not dead-lock the pool.  A
+ * waiting thread only executes tasks of the group it waits for, such that
+ * tasks of other callers never run on a thread with the caller's thread-local
+ * state, e.g. an active ArenaScope.  Workers execute tasks of any group.
+ * @addtogroup base
+ */
+class GTSAM_EXPORT ThreadPool {
+ public:
+  typedef std::function<void()> Task;
+
+  /// Identifies the tasks a waiting thread may execute, see createGroup()
+  typedef size_t Group;
+
+  /// Create a pool using numThreads threads, or one per hardware thread if 0
+  explicit ThreadPool(size_t numThreads = 0);
+
+  /// Finishes all queued tasks and joins the workers
+  ~ThreadPool();
+
+  /// Number of threads executing tasks, including the waiting thread
+  size_t numThreads() const { return workers_.size() + 1; }
+
+  /// A new group, distinct from all groups created before and from group 0
+  Group createGroup() { return ++lastGroup_; }
+
+  /// Queue a task in a group. Tasks may not throw, see parallelFor for error
+  /// handling.
+  void schedule(Task task, Group group = 0);
+
+  /// Execute queued tasks of the given group in this thread until done()
+  /// returns true. done() is evaluated whenever a task finishes, and has to
+  /// become true as a result of executing tasks of the group.
+  void waitUntil(const std::function<bool()>& done, Group group = 0);
+
+  /**
+   * Call function(i0, i1) on consecutive sub-ranges [i0, i1) of [begin, end) in
+   * parallel and wait for all of them. If any call throws, the first exception
+   * is re-thrown here after all sub-ranges finished.
+   * @param grainSize The size of the sub-ranges, or 0 to split the range into
+   *        a few sub-ranges per thread.
+   */
+  template <typename FUNCTION>
+  void parallelFor(size_t begin, size_t end, const FUNCTION& function,
+                   size_t grainSize = 0);
+
+  /// The pool used internally by GTSAM, created on first use
+  static ThreadPool& Global();
+
+  /// Replace the global pool by one with numThreads threads (0: hardware
+  /// concurrency). Must not be called while the global pool is in use.
+  static void SetGlobalNumThreads(size_t numThreads);
+
+ private:
+  std::vector<std::thread> workers_;
+  std::deque<std::pair<Group, Task> > tasks_;
+  std::atomic<Group> lastGroup_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_;
+
+  /// Worker thread main loop
+  void work();
+
+  /// Remove and run a queued task, lock is released while it runs
+  void run(std::deque<std::pair<Group, Task> >::iterator task,
+           std::unique_lock<std::mutex>& lock);
+
+  // Not copyable
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+/* ************************************************************************* */
+template <typename FUNCTION>
+void ThreadPool::parallelFor(size_t begin, size_t end,
+                             const FUNCTION& function, size_t grainSize) {
+  if (begin >= end) return;
+  if (grainSize == 0)
+    grainSize = std::max<size_t>(1, (end - begin) / (4 * numThreads()));
+  if (workers_.empty() || end - begin <= grainSize) {
+    function(begin, end);
+    return;
+  }
+
+  const Group group = createGroup();
+  std::atomic<size_t> remaining((end - begin + grainSize - 1) / grainSize);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  for (size_t first = begin; first < end; first += grainSize) {
+    const size_t last = std::min(first + grainSize, end);
+    schedule([&, first, last]() {
+      try {
+        function(first, last);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) error = std::current_exception();
+      }
+      --remaining;
+    }, group);
+  }
+  waitUntil([&remaining]() { return remaining == 0; }, group);
+
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace gtsam
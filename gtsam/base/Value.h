@@ -66,6 +66,13 @@ namespace gtsam {
      */
     virtual Value* retract_(const Vector& delta) const = 0;
 
+    /** Version of retract_() for a delta of dim() contiguous doubles, e.g., a
+     * segment of a larger vector, which avoids copying it into a Vector.
+     */
+    virtual Value* retract_(const double* delta) const {
+      return retract_(Vector(Eigen::Map<const Vector>(delta, dim())));
+    }
+
     /** Compute the coordinates in the tangent space of this value that
      * retract() would map to \c value.
      * @param value The value whose coordinates should be determined in the
@@ -17,10 +17,12 @@
  */
 
 #include <gtsam/base/debug.h>
-#include <gtsam/config.h> // for GTSAM_USE_TBB
+#include <gtsam/config.h> // for GTSAM_USE_TBB and GTSAM_USE_THREAD_POOL
 
 #ifdef GTSAM_USE_TBB
 #include <tbb/mutex.h>
+#elif defined GTSAM_USE_THREAD_POOL
+#include <mutex>
 #endif
 
 namespace gtsam {
@@ -29,12 +31,16 @@ GTSAM_EXPORT FastMap<std::string, ValueWithDefault<bool, false> > debugFlags;
 
 #ifdef GTSAM_USE_TBB
 tbb::mutex debugFlagsMutex;
+#elif defined GTSAM_USE_THREAD_POOL
+std::mutex debugFlagsMutex;
 #endif
 
 /* ************************************************************************* */
 bool guardedIsDebug(const std::string& s) {
 #ifdef GTSAM_USE_TBB
   tbb::mutex::scoped_lock lock(debugFlagsMutex);
+#elif defined GTSAM_USE_THREAD_POOL
+  std::lock_guard<std::mutex> lock(debugFlagsMutex);
 #endif
   return gtsam::debugFlags[s];
 }
@@ -43,6 +49,8 @@ bool guardedIsDebug(const std::string& s) {
 void guardedSetDebug(const std::string& s, const bool v) {
 #ifdef GTSAM_USE_TBB
   tbb::mutex::scoped_lock lock(debugFlagsMutex);
+#elif defined GTSAM_USE_THREAD_POOL
+  std::lock_guard<std::mutex> lock(debugFlagsMutex);
 #endif
   gtsam::debugFlags[s] = v;
 }
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testArena.cpp
+ * @brief   Unit tests for Arena
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/base/Arena.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+TEST(Arena, allocateAndReset) {
+  Arena arena(256);
+  void* first = arena.allocate(100, 8);
+  arena.allocate(100, 8);
+  EXPECT_LONGS_EQUAL(2, arena.liveAllocations());
+  EXPECT(arena.used() >= 200);
+
+  // Overflowing the block adds another one
+  arena.allocate(200, 8);
+  EXPECT(arena.capacity() > 256);
+
+  // Reset is refused while allocations are live
+  EXPECT(!arena.reset());
+  for (int i = 0; i < 3; ++i) arena.deallocate(nullptr, 0);
+  EXPECT(arena.reset());
+  EXPECT_LONGS_EQUAL(0, arena.used());
+
+  // Blocks were merged into one that holds the same allocations again
+  const size_t capacity = arena.capacity();
+  void* again = arena.allocate(100, 8);
+  arena.allocate(100, 8);
+  arena.allocate(200, 8);
+  EXPECT_LONGS_EQUAL(capacity, arena.capacity());
+  EXPECT(first != nullptr && again != nullptr);
+  for (int i = 0; i < 3; ++i) arena.deallocate(nullptr, 0);
+}
+
+/* ************************************************************************* */
+TEST(Arena, alignment) {
+  Arena arena;
+  arena.allocate(1, 1);
+  for (size_t alignment : {2, 8, 16, 64}) {
+    void* p = arena.allocate(3, alignment);
+    EXPECT_LONGS_EQUAL(0, reinterpret_cast<uintptr_t>(p) % alignment);
+  }
+  for (int i = 0; i < 5; ++i) arena.deallocate(nullptr, 0);
+}
+
+/* ************************************************************************* */
+TEST(Arena, allocateShared) {
+  // Without a scope, objects come from the heap
+  EXPECT(Arena::Current() == nullptr);
+  boost::shared_ptr<vector<double>> heap = allocateShared<vector<double>>(3, 1.0);
+  EXPECT_LONGS_EQUAL(3, heap->size());
+
+  Arena arena;
+  {
+    ArenaScope scope(&arena);
+    EXPECT(Arena::Current() == &arena);
+    boost::shared_ptr<vector<double>> object =
+        allocateShared<vector<double>>(3, 2.0);
+    EXPECT_DOUBLES_EQUAL(2.0, (*object)[2], 1e-9);
+    EXPECT_LONGS_EQUAL(1, arena.liveAllocations());
+    {
+      // A null scope disables the arena
+      ArenaScope inner(nullptr);
+      allocateShared<double>(1.0);
+      EXPECT_LONGS_EQUAL(1, arena.liveAllocations());
+    }
+    EXPECT(Arena::Current() == &arena);
+    EXPECT(!arena.reset());
+  }
+  EXPECT(Arena::Current() == nullptr);
+  EXPECT_LONGS_EQUAL(0, arena.liveAllocations());
+  EXPECT(arena.reset());
+}
+
+/* ************************************************************************* */
+TEST(Arena, outlive) {
+  // Objects keep the memory of the arena alive after it is destroyed
+  boost::shared_ptr<vector<double>> object;
+  {
+    Arena arena;
+    ArenaScope scope(&arena);
+    object = allocateShared<vector<double>>(3, 2.0);
+    EXPECT(!arena.reset());
+  }
+  EXPECT_DOUBLES_EQUAL(2.0, (*object)[2], 1e-9);
+  object.reset();
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
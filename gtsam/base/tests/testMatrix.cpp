@@ -837,6 +837,28 @@ TEST(Matrix, eigen_QR )
   EXPECT(assert_equal(expected, A, 1e-3));
 }
 
+/* ************************************************************************* */
+TEST(Matrix, inplace_QR_tall)
+{
+  // Tall enough to be factored in blocks of rows
+  Matrix A(2000, 21);
+  for (DenseIndex i = 0; i < A.rows(); i++)
+    for (DenseIndex j = 0; j < A.cols(); j++)
+      A(i, j) = sin(0.7 * i + 1.3 * j) + (i % A.cols() == j ? 2.0 : 0.0);
+
+  Matrix R = A;
+  inplace_QR(R);
+  EXPECT(R.bottomRows(R.rows() - R.cols()).isZero());
+  EXPECT(R.topRows(R.cols()).isUpperTriangular());
+
+  // Same as the unblocked factorization, up to signs of rows
+  Matrix expected = A.householderQr().matrixQR().topRows(A.cols());
+  zeroBelowDiagonal(expected);
+  for (DenseIndex i = 0; i < expected.rows(); i++)
+    if (expected(i, i) * R(i, i) < 0) expected.row(i) *= -1;
+  EXPECT(assert_equal(expected, Matrix(R.topRows(R.cols())), 1e-9));
+}
+
 /* ************************************************************************* */
 // unit test for qr factorization (and hence householder)
 // This behaves the same as QR in matlab: [Q,R] = qr(A), except for signs
@@ -168,6 +168,34 @@ TEST(SymmetricBlockMatrix, inverseInPlace) {
   EXPECT(assert_equal(expectedInverse, symmMatrix.selfadjointView()));
 }
 
+/* ************************************************************************* */
+TEST(SymmetricBlockMatrix, fixedSizeUpdates) {
+  // An augmented Jacobian on two 3-dimensional variables, which are the third
+  // and first block of the destination, such that one product is transposed
+  Matrix Ab(5, 7);
+  for (DenseIndex i = 0; i < Ab.rows(); i++)
+    for (DenseIndex j = 0; j < Ab.cols(); j++) Ab(i, j) = cos(i + 2.0 * j);
+  const std::vector<DenseIndex> slots = list_of(2)(0)(3);
+
+  Matrix scattered = Matrix::Zero(5, 10);
+  scattered.middleCols(6, 3) = Ab.leftCols(3);
+  scattered.middleCols(0, 3) = Ab.middleCols(3, 3);
+  scattered.col(9) = Ab.col(6);
+  const Matrix expected = scattered.transpose() * scattered;
+
+  SymmetricBlockMatrix fromJacobian(list_of(3)(3)(3)(1));
+  fromJacobian.setZero();
+  fromJacobian.updateFromAugmentedJacobian<3>(Ab, slots);
+  EXPECT(assert_equal(expected, fromJacobian.selfadjointView(), 1e-9));
+
+  const SymmetricBlockMatrix hessian(list_of(3)(3)(1),
+                                     Matrix(Ab.transpose() * Ab));
+  SymmetricBlockMatrix fromHessian(list_of(3)(3)(3)(1));
+  fromHessian.setZero();
+  fromHessian.updateFromSymmetric<3>(hessian, slots);
+  EXPECT(assert_equal(expected, fromHessian.selfadjointView(), 1e-9));
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
 /* ************************************************************************* */
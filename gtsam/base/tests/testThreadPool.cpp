@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testThreadPool.cpp
+ * @brief   Unit tests for the std::thread pool
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/base/ThreadPool.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+TEST(ThreadPool, numThreads) {
+  ThreadPool single(1);
+  EXPECT_LONGS_EQUAL(1, single.numThreads());
+
+  ThreadPool four(4);
+  EXPECT_LONGS_EQUAL(4, four.numThreads());
+
+  ThreadPool automatic;
+  EXPECT(automatic.numThreads() >= 1);
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, parallelFor) {
+  for (size_t numThreads : {1, 3, 8}) {
+    ThreadPool pool(numThreads);
+    vector<int> visited(1000, 0);
+    pool.parallelFor(0, visited.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) visited[i] += 1;
+    }, 7);
+    for (int count : visited) EXPECT_LONGS_EQUAL(1, count);
+
+    // Automatic grain size and empty ranges
+    std::atomic<size_t> sum(0);
+    pool.parallelFor(10, 110, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) sum += i;
+    });
+    EXPECT_LONGS_EQUAL(5950, sum);
+    pool.parallelFor(5, 5, [&](size_t, size_t) { sum = 0; });
+    EXPECT_LONGS_EQUAL(5950, sum);
+  }
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, exception) {
+  ThreadPool pool(4);
+  std::atomic<size_t> count(0);
+  CHECK_EXCEPTION(pool.parallelFor(0, 100, [&](size_t begin, size_t end) {
+    count += end - begin;
+    if (begin == 50) throw std::runtime_error("failure");
+  }, 10), std::runtime_error);
+
+  // All other sub-ranges were still executed, and the pool is still usable
+  EXPECT_LONGS_EQUAL(100, count);
+  pool.parallelFor(0, 100, [&](size_t begin, size_t end) { count += end - begin; });
+  EXPECT_LONGS_EQUAL(200, count);
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, nested) {
+  // Waiting from within a task executes other tasks instead of blocking
+  ThreadPool pool(2);
+  std::atomic<size_t> count(0);
+  pool.parallelFor(0, 8, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      pool.parallelFor(0, 10, [&](size_t b, size_t e) { count += e - b; }, 1);
+    }
+  }, 1);
+  EXPECT_LONGS_EQUAL(80, count);
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, schedule) {
+  std::atomic<size_t> count(0);
+  {
+    ThreadPool pool(3);
+    for (size_t i = 0; i < 20; ++i) pool.schedule([&count]() { ++count; });
+    pool.waitUntil([&count]() { return count == 20; });
+    EXPECT_LONGS_EQUAL(20, count);
+
+    // Tasks still queued on destruction are executed
+    for (size_t i = 0; i < 20; ++i) pool.schedule([&count]() { ++count; });
+  }
+  EXPECT_LONGS_EQUAL(40, count);
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, groups) {
+  // Without workers, only the waiting thread executes tasks, and only those
+  // of the group it waits for
+  ThreadPool pool(1);
+  bool foreign = false, own = false;
+  pool.schedule([&foreign]() { foreign = true; });
+  const ThreadPool::Group group = pool.createGroup();
+  EXPECT(group != 0);
+  pool.schedule([&own]() { own = true; }, group);
+  pool.waitUntil([&own]() { return own; }, group);
+  EXPECT(!foreign);
+  pool.waitUntil([&foreign]() { return foreign; });
+  EXPECT(foreign);
+}
+
+/* ************************************************************************* */
+TEST(ThreadPool, Global) {
+  ThreadPool::SetGlobalNumThreads(3);
+  EXPECT_LONGS_EQUAL(3, ThreadPool::Global().numThreads());
+  ThreadPool::SetGlobalNumThreads(0);
+  EXPECT(ThreadPool::Global().numThreads() >= 1);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
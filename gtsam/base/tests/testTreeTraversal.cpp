@@ -19,8 +19,10 @@
 #include <gtsam/base/TestableAssertions.h>
 #include <gtsam/base/treeTraversal-inst.h>
 
-#include <vector>
+#include <atomic>
 #include <list>
+#include <stdexcept>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/assign/std/list.hpp>
@@ -154,6 +156,95 @@ TEST(treeTraversal, CloneForest)
   EXPECT(assert_container_equality(preOrderModifiedExpected, preOrder2ModActual));
 }
 
+/* ************************************************************************* */
+struct ParallelTestNode {
+  typedef boost::shared_ptr<ParallelTestNode> shared_ptr;
+  int data;
+  bool postVisited;
+  vector<shared_ptr> children;
+  ParallelTestNode(int data) : data(data), postVisited(false) {}
+  int problemSize() const { return 20; }
+};
+
+struct ParallelTestForest {
+  typedef ParallelTestNode Node;
+  typedef Node::shared_ptr sharedNode;
+  FastVector<sharedNode> roots_;
+  const FastVector<sharedNode>& roots() const { return roots_; }
+};
+
+// Complete binary trees, node i has children 2i+1 and 2i+2
+ParallelTestNode::shared_ptr makeBinaryTree(int i, int n) {
+  ParallelTestNode::shared_ptr node = boost::make_shared<ParallelTestNode>(i);
+  for (int child = 2 * i + 1; child <= 2 * i + 2 && child < n; ++child)
+    node->children.push_back(makeBinaryTree(child, n));
+  return node;
+}
+
+struct DepthPreVisitor {
+  std::atomic<int> nrVisited{0};
+  std::atomic<bool> parentsMatched{true};
+  int operator()(const ParallelTestNode::shared_ptr& node, int parentData) {
+    ++nrVisited;
+    if (parentData != (node->data - 1) / 2 && parentData != -1)
+      parentsMatched = false;
+    return node->data;
+  }
+};
+
+struct ChildrenFirstPostVisitor {
+  std::atomic<int> nrVisited{0};
+  std::atomic<bool> childrenFirst{true};
+  void operator()(const ParallelTestNode::shared_ptr& node, int myData) {
+    ++nrVisited;
+    for (const ParallelTestNode::shared_ptr& child : node->children)
+      if (!child->postVisited)
+        childrenFirst = false;
+    if (myData != node->data)
+      childrenFirst = false;
+    node->postVisited = true;
+  }
+};
+
+/* ************************************************************************* */
+TEST(treeTraversal, DepthFirstParallel)
+{
+  ParallelTestForest forest;
+  forest.roots_.push_back(makeBinaryTree(0, 1000));
+  forest.roots_.push_back(makeBinaryTree(0, 5));
+
+  DepthPreVisitor preVisitor;
+  ChildrenFirstPostVisitor postVisitor;
+  int rootData = -1;
+  treeTraversal::DepthFirstForestParallel(forest, rootData, preVisitor, postVisitor, 10);
+
+  EXPECT_LONGS_EQUAL(1005, preVisitor.nrVisited);
+  EXPECT_LONGS_EQUAL(1005, postVisitor.nrVisited);
+  EXPECT(preVisitor.parentsMatched);
+  EXPECT(postVisitor.childrenFirst);
+}
+
+/* ************************************************************************* */
+struct ThrowingPostVisitor {
+  void operator()(const ParallelTestNode::shared_ptr& node, int) {
+    if (node->data == 17)
+      throw std::runtime_error("failure");
+  }
+};
+
+TEST(treeTraversal, DepthFirstParallelException)
+{
+  ParallelTestForest forest;
+  forest.roots_.push_back(makeBinaryTree(0, 100));
+
+  DepthPreVisitor preVisitor;
+  ThrowingPostVisitor postVisitor;
+  int rootData = -1;
+  CHECK_EXCEPTION(treeTraversal::DepthFirstForestParallel(
+                      forest, rootData, preVisitor, postVisitor, 10),
+                  std::runtime_error);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -22,7 +22,7 @@
 #include <gtsam/base/FastList.h>
 #include <gtsam/base/FastVector.h>
 #include <gtsam/inference/Key.h>
-#include <gtsam/config.h> // for GTSAM_USE_TBB
+#include <gtsam/config.h> // for GTSAM_USE_TBB and GTSAM_USE_THREAD_POOL
 
 #include <stack>
 #include <vector>
@@ -161,6 +161,13 @@ void DepthFirstForestParallel(FOREST& forest, DATA& rootData,
   tbb::task::spawn_root_and_wait(
       internal::CreateRootTask<Node>(forest.roots(), rootData, visitorPre,
           visitorPost, problemSizeThreshold));
+#elif defined GTSAM_USE_THREAD_POOL
+  // Typedefs
+  typedef typename FOREST::Node Node;
+
+  internal::PoolTraversal<Node, DATA, VISITOR_PRE, VISITOR_POST> traversal(
+      ThreadPool::Global(), visitorPre, visitorPost, problemSizeThreshold);
+  traversal.run(forest.roots(), rootData);
 #else
   DepthFirstForest(forest, rootData, visitorPre, visitorPost);
 #endif
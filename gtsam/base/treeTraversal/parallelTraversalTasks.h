@@ -203,4 +203,186 @@ namespace gtsam {
 
 }
 
+#elif defined GTSAM_USE_THREAD_POOL
+#  include <gtsam/base/ThreadPool.h>
+
+#  include <atomic>
+#  include <exception>
+#  include <mutex>
+#  include <vector>
+
+namespace gtsam {
+
+  /** Internal functions used for traversing trees */
+  namespace treeTraversal {
+
+    namespace internal {
+
+      /* ************************************************************************* */
+      /** Parallel depth-first traversal on a ThreadPool, mirroring the TBB tasks above:  the
+       *  pre-order visitor of all children of a node is called in the task of the node, after
+       *  which a task is queued for each child.  The post-order visitor of a node is called by
+       *  the task that finishes its last child, so that no thread ever blocks on another one. */
+      template<typename NODE, typename DATA, typename VISITOR_PRE, typename VISITOR_POST>
+      class PoolTraversal
+      {
+        struct Task
+        {
+          const boost::shared_ptr<NODE>& treeNode;
+          DATA myData;
+          Task* parent;
+          bool makeNewTasks;
+          std::atomic<size_t> pendingChildren;
+
+          Task(const boost::shared_ptr<NODE>& treeNode, const DATA& myData, Task* parent,
+               bool makeNewTasks)
+              : treeNode(treeNode), myData(myData), parent(parent),
+                makeNewTasks(makeNewTasks), pendingChildren(0) {}
+        };
+
+        ThreadPool& pool_;
+        VISITOR_PRE& visitorPre_;
+        VISITOR_POST& visitorPost_;
+        int problemSizeThreshold_;
+        const ThreadPool::Group group_;
+        std::atomic<size_t> pendingRoots_;
+        std::atomic<bool> failed_;
+        std::mutex errorMutex_;
+        std::exception_ptr error_;
+
+      public:
+        PoolTraversal(ThreadPool& pool, VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost,
+                      int problemSizeThreshold)
+            : pool_(pool), visitorPre_(visitorPre), visitorPost_(visitorPost),
+              problemSizeThreshold_(problemSizeThreshold), group_(pool.createGroup()),
+              pendingRoots_(0), failed_(false) {}
+
+        template<typename ROOTS>
+        void run(const ROOTS& roots, DATA& rootData)
+        {
+          // Create data and tasks for the roots in this thread
+          std::vector<Task*> tasks;
+          tasks.reserve(roots.size());
+          try {
+            for(const boost::shared_ptr<NODE>& root: roots)
+              tasks.push_back(new Task(root, visitorPre_(root, rootData), 0, true));
+          } catch(...) {
+            for(Task* task: tasks)
+              delete task;
+            throw;
+          }
+
+          pendingRoots_ = tasks.size();
+          for(Task* task: tasks)
+            pool_.schedule([this, task]() { process(task); }, group_);
+          pool_.waitUntil([this]() { return pendingRoots_ == 0; }, group_);
+
+          if(error_)
+            std::rethrow_exception(error_);
+        }
+
+      private:
+        void setError()
+        {
+          std::lock_guard<std::mutex> lock(errorMutex_);
+          if(!error_)
+            error_ = std::current_exception();
+          failed_ = true;
+        }
+
+        void process(Task* task)
+        {
+          const boost::shared_ptr<NODE>& node = task->treeNode;
+          if(!failed_ && !node->children.empty())
+          {
+            if(task->makeNewTasks)
+            {
+              bool overThreshold = (node->problemSize() >= problemSizeThreshold_);
+
+              // Run the pre-order visitor on all children before queueing any of them, so that
+              // the parent data is not modified anymore once the children run.
+              std::vector<Task*> children;
+              children.reserve(node->children.size());
+              try {
+                for(const boost::shared_ptr<NODE>& child: node->children)
+                  children.push_back(new Task(child, visitorPre_(child, task->myData), task,
+                                              overThreshold));
+              } catch(...) {
+                setError();
+                for(Task* child: children)
+                  delete child;
+                children.clear();
+              }
+
+              if(!children.empty())
+              {
+                task->pendingChildren = children.size();
+                for(Task* child: children)
+                  pool_.schedule([this, child]() { process(child); }, group_);
+                return;
+              }
+            }
+            else
+            {
+              // Process the children of this node in this task
+              try {
+                for(const boost::shared_ptr<NODE>& child: node->children)
+                {
+                  DATA childData = visitorPre_(child, task->myData);
+                  processNodeRecursively(child, childData);
+                }
+              } catch(...) {
+                setError();
+              }
+            }
+          }
+          finish(task);
+        }
+
+        void processNodeRecursively(const boost::shared_ptr<NODE>& node, DATA& myData)
+        {
+          for(const boost::shared_ptr<NODE>& child: node->children)
+          {
+            DATA childData = visitorPre_(child, myData);
+            processNodeRecursively(child, childData);
+          }
+
+          // Run the post-order visitor
+          (void) visitorPost_(node, myData);
+        }
+
+        // Run the post-order visitor of a node whose children are all done, and of all
+        // ancestors for which this was the last remaining child.
+        void finish(Task* task)
+        {
+          while(task)
+          {
+            if(!failed_)
+            {
+              try {
+                (void) visitorPost_(task->treeNode, task->myData);
+              } catch(...) {
+                setError();
+              }
+            }
+            Task* parent = task->parent;
+            delete task;
+            if(!parent)
+            {
+              --pendingRoots_; // The traversal object may be destroyed after this
+              return;
+            }
+            if(--parent->pendingChildren != 0)
+              return;
+            task = parent;
+          }
+        }
+      };
+
+    }
+
+  }
+
+}
+
 #endif
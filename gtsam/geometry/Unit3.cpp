@@ -21,7 +21,7 @@
 
 #include <gtsam/geometry/Unit3.h>
 #include <gtsam/geometry/Point2.h>
-#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/config.h>  // for GTSAM_USE_TBB and GTSAM_USE_THREAD_POOL
 
 #ifdef __clang__
 #  pragma clang diagnostic push
@@ -85,6 +85,8 @@ const Matrix32& Unit3::basis(OptionalJacobian<6, 2> H) const {
   // deadlock. However, I don't know why and I can no longer reproduce it.
   // It either was a red herring or there is still a latent bug left to debug.
   tbb::mutex::scoped_lock lock(B_mutex_);
+#elif defined GTSAM_USE_THREAD_POOL
+  std::lock_guard<std::mutex> lock(B_mutex_);
 #endif
 
   const bool cachedBasis = static_cast<bool>(B_);
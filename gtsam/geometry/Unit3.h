@@ -34,6 +34,8 @@
 
 #ifdef GTSAM_USE_TBB
 #include <tbb/mutex.h>
+#elif defined GTSAM_USE_THREAD_POOL
+#include <mutex>
 #endif
 
 namespace gtsam {
@@ -49,6 +51,8 @@ private:
 
 #ifdef GTSAM_USE_TBB
   mutable tbb::mutex B_mutex_; ///< Mutex to protect the cached basis.
+#elif defined GTSAM_USE_THREAD_POOL
+  mutable std::mutex B_mutex_; ///< Mutex to protect the cached basis.
 #endif
 
 public:
@@ -12,9 +12,14 @@
 #include <gtsam/inference/ClusterTree.h>
 #include <gtsam/inference/BayesTree.h>
 #include <gtsam/inference/Ordering.h>
+#include <gtsam/base/Arena.h>
 #include <gtsam/base/timing.h>
 #include <gtsam/base/treeTraversal-inst.h>
 
+#ifdef GTSAM_USE_THREAD_POOL
+#include <mutex>
+#endif
+
 namespace gtsam {
 
 /* ************************************************************************* */
@@ -122,7 +127,7 @@ struct EliminationData {
   boost::shared_ptr<BTNode> bayesTreeNode;
 
   EliminationData(EliminationData* _parentData, size_t nChildren) :
-      parentData(_parentData), bayesTreeNode(boost::make_shared<BTNode>()) {
+      parentData(_parentData), bayesTreeNode(allocateShared<BTNode>()) {
     if (parentData) {
       myIndexInParent = parentData->childFactors.size();
       parentData->childFactors.push_back(sharedFactor());
@@ -152,6 +157,9 @@ struct EliminationData {
   class EliminationPostOrderVisitor {
     const typename CLUSTERTREE::Eliminate& eliminationFunction_;
     typename CLUSTERTREE::BayesTreeType::Nodes& nodesIndex_;
+#ifdef GTSAM_USE_THREAD_POOL
+    std::mutex nodesIndexMutex_;  // Without TBB, Nodes is not safe for concurrent insertion
+#endif
 
   public:
     // Construct functor
@@ -192,8 +200,13 @@ struct EliminationData {
       // Fill nodes index - we do this here instead of calling insertRoot at the end to avoid
       // putting orphan subtrees in the index - they'll already be in the index of the ISAM2
       // object they're added to.
-      for (const Key& j: myData.bayesTreeNode->conditional()->frontals())
-        nodesIndex_.insert(std::make_pair(j, myData.bayesTreeNode));
+      {
+#ifdef GTSAM_USE_THREAD_POOL
+        std::lock_guard<std::mutex> lock(nodesIndexMutex_);
+#endif
+        for (const Key& j: myData.bayesTreeNode->conditional()->frontals())
+          nodesIndex_.insert(std::make_pair(j, myData.bayesTreeNode));
+      }
 
       // Store remaining factor in parent's gathered factors
       if (!eliminationResult.second->empty())
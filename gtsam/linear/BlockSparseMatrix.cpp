@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockSparseMatrix.cpp
+ * @brief   The Hessian of a GaussianFactorGraph in block sparse row format
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/BlockSparseMatrix.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/base/ThreadPool.h>
+#include <gtsam/base/timing.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+BlockSparseMatrix::BlockSparseMatrix(const GaussianFactorGraph& gfg,
+                                     const KeyInfo& keyInfo) {
+  gttic(BlockSparseMatrix_assemble);
+  const size_t n = keyInfo.size();
+  Scatter scatter;
+  scatter.reserve(n);
+  for (Key key : keyInfo.ordering()) scatter.emplace_back(key, keyInfo.at(key).dim);
+  layout_ = boost::make_shared<FlatVectorValues::Layout>(scatter);
+
+  // Block indices of the variables of each factor
+  vector<vector<size_t> > indices(gfg.size());
+  vector<vector<size_t> > pattern(n);
+  for (size_t f = 0; f < gfg.size(); ++f) {
+    if (!gfg[f]) continue;
+    for (Key key : gfg[f]->keys()) indices[f].push_back(keyInfo.at(key).index);
+    for (size_t i : indices[f])
+      pattern[i].insert(pattern[i].end(), indices[f].begin(), indices[f].end());
+  }
+
+  // Sorted pattern of each block row, and the position of each block
+  rowStarts_.assign(1, 0);
+  size_t size = 0;
+  for (size_t i = 0; i < n; ++i) {
+    vector<size_t>& row = pattern[i];
+    sort(row.begin(), row.end());
+    row.erase(unique(row.begin(), row.end()), row.end());
+    for (size_t j : row) {
+      columns_.push_back(j);
+      blockOffsets_.push_back(size);
+      size += dim(i) * dim(j);
+    }
+    rowStarts_.push_back(columns_.size());
+  }
+
+  // Add the information of every factor, directly from its blocks for the
+  // common factor types, without forming its augmented information matrix
+  values_.setZero(size);
+  eta_.setZero(rows());
+  for (size_t f = 0; f < gfg.size(); ++f) {
+    const GaussianFactor* factor = gfg[f].get();
+    if (!factor) continue;
+    if (const JacobianFactor* jacobian =
+            dynamic_cast<const JacobianFactor*>(factor)) {
+      if (!jacobian->isConstrained()) {
+        addJacobian(*jacobian, indices[f]);
+        continue;
+      }
+    } else if (const HessianFactor* hessian =
+                   dynamic_cast<const HessianFactor*>(factor)) {
+      addHessian(*hessian, indices[f]);
+      continue;
+    }
+    addInformation(factor->augmentedInformation(), indices[f]);
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseMatrix::addJacobian(const JacobianFactor& factor,
+                                    const vector<size_t>& indices) {
+  // Only a non-unit noise model needs a whitened copy of [A b]
+  Matrix whitened;
+  const SharedDiagonal& model = factor.get_model();
+  if (model && !model->isUnit())
+    whitened = model->Whiten(factor.matrixObject().full());
+  const Eigen::Ref<const Matrix> Ab =
+      whitened.size() ? Eigen::Ref<const Matrix>(whitened)
+                      : Eigen::Ref<const Matrix>(factor.matrixObject().full());
+  const auto b = Ab.col(Ab.cols() - 1);
+
+  DenseIndex colI = 0;
+  for (size_t I = 0; I < indices.size(); ++I) {
+    const size_t i = indices[I];
+    const auto Ai = Ab.middleCols(colI, dim(i));
+    eta_.segment(offset(i), dim(i)).noalias() += Ai.transpose() * b;
+    block(i, find(i, i)).noalias() += Ai.transpose() * Ai;
+    DenseIndex colJ = colI + dim(i);
+    for (size_t J = I + 1; J < indices.size(); ++J) {
+      const size_t j = indices[J];
+      const auto Aj = Ab.middleCols(colJ, dim(j));
+      auto Hij = block(i, find(i, j));
+      Hij.noalias() += Ai.transpose() * Aj;
+      block(j, find(j, i)) = Hij.transpose();
+      colJ += dim(j);
+    }
+    colI += dim(i);
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseMatrix::addHessian(const HessianFactor& factor,
+                                   const vector<size_t>& indices) {
+  const SymmetricBlockMatrix& info = factor.info();
+  for (size_t I = 0; I < indices.size(); ++I) {
+    const size_t i = indices[I];
+    eta_.segment(offset(i), dim(i)) += factor.linearTerm(factor.begin() + I);
+    block(i, find(i, i)) += info.diagonalBlock(I).toDenseMatrix();
+    for (size_t J = I + 1; J < indices.size(); ++J) {
+      const size_t j = indices[J];
+      auto Hij = block(i, find(i, j));
+      Hij += info.aboveDiagonalBlock(I, J);
+      block(j, find(j, i)) = Hij.transpose();
+    }
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseMatrix::addInformation(const Matrix& information,
+                                       const vector<size_t>& indices) {
+  const DenseIndex last = information.cols() - 1;
+  DenseIndex rowStart = 0;
+  for (size_t i : indices) {
+    const DenseIndex rows = dim(i);
+    eta_.segment(offset(i), rows) += information.block(rowStart, last, rows, 1);
+    DenseIndex colStart = 0;
+    for (size_t j : indices) {
+      const DenseIndex cols = dim(j);
+      block(i, find(i, j)) += information.block(rowStart, colStart, rows, cols);
+      colStart += cols;
+    }
+    rowStart += rows;
+  }
+}
+
+/* ************************************************************************* */
+size_t BlockSparseMatrix::find(size_t i, size_t j) const {
+  const vector<size_t>::const_iterator begin = columns_.begin() + rowStarts_[i],
+                                       end = columns_.begin() + rowStarts_[i + 1];
+  const vector<size_t>::const_iterator it = lower_bound(begin, end, j);
+  return (it != end && *it == j) ? size_t(it - columns_.begin()) : kNotFound;
+}
+
+/* ************************************************************************* */
+void BlockSparseMatrix::multiply(const Vector& x, Vector& y) const {
+  y.resize(rows());
+  auto multiplyRows = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      auto yi = y.segment(offset(i), dim(i));
+      yi.setZero();
+      for (size_t k = rowStarts_[i]; k < rowStarts_[i + 1]; ++k) {
+        const size_t j = columns_[k];
+        yi.noalias() += block(i, k) * x.segment(offset(j), dim(j));
+      }
+    }
+  };
+#ifdef GTSAM_USE_THREAD_POOL
+  // Block rows write disjoint parts of y, so no synchronization is needed
+  static const size_t grainSize = 64;
+  ThreadPool::Global().parallelFor(0, blockRows(), multiplyRows, grainSize);
+#else
+  multiplyRows(0, blockRows());
+#endif
+}
+
+/* ************************************************************************* */
+Matrix BlockSparseMatrix::dense() const {
+  Matrix result = Matrix::Zero(rows(), rows());
+  for (size_t i = 0; i < blockRows(); ++i)
+    for (size_t k = rowStarts_[i]; k < rowStarts_[i + 1]; ++k)
+      result.block(offset(i), offset(columns_[k]), dim(i), dim(columns_[k])) =
+          block(i, k);
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockSparseMatrix.h
+ * @brief   The Hessian of a GaussianFactorGraph in block sparse row format
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/FlatVectorValues.h>
+#include <gtsam/base/Matrix.h>
+#include <gtsam/base/Vector.h>
+
+#include <limits>
+#include <vector>
+
+namespace gtsam {
+
+class GaussianFactorGraph;
+class HessianFactor;
+class JacobianFactor;
+class KeyInfo;
+
+/**
+ * The Hessian H = A'A and information vector eta = A'b of a
+ * GaussianFactorGraph, assembled once in block sparse row (BSR) format: block
+ * row i holds the non-zero blocks H(i,j), sorted by j, and all blocks are
+ * stored column-major in one contiguous array, in row order.  Both triangles
+ * are stored, such that every block row of a product only reads its own
+ * blocks.
+ *
+ * Block rows, and the scalar layout of vectors, follow the ordering of a
+ * KeyInfo, as in the iterative solvers, and are described by a
+ * FlatVectorValues::Layout, so that solutions can be stored in a
+ * FlatVectorValues sharing it.  Compared to the per-factor virtual
+ * multiplyHessianAdd calls of GaussianFactorGraph, multiply() streams through
+ * memory once, and is parallelized over block rows when GTSAM is built with
+ * the thread pool.
+ */
+class GTSAM_EXPORT BlockSparseMatrix {
+ public:
+  /// Returned by find() for blocks that are not in the pattern
+  static const size_t kNotFound = std::numeric_limits<size_t>::max();
+
+  /// Assemble the Hessian of \c gfg, in the order and layout of \c keyInfo
+  BlockSparseMatrix(const GaussianFactorGraph& gfg, const KeyInfo& keyInfo);
+
+  /// Number of block rows, i.e., variables
+  size_t blockRows() const { return layout_->scatter.size(); }
+
+  /// Number of scalar rows
+  size_t rows() const { return layout_->dim; }
+
+  /// Keys, dimensions and offsets of the block rows
+  const boost::shared_ptr<const FlatVectorValues::Layout>& layout() const {
+    return layout_;
+  }
+
+  /// Number of non-zero blocks, counting both triangles
+  size_t nonZeroBlocks() const { return columns_.size(); }
+
+  /// Dimension of variable \c i
+  size_t dim(size_t i) const { return layout_->scatter[i].dimension; }
+
+  /// First scalar row of variable \c i
+  size_t offset(size_t i) const { return layout_->offsets[i]; }
+
+  /// Blocks of row \c i are the entries [rowBegin(i), rowEnd(i))
+  size_t rowBegin(size_t i) const { return rowStarts_[i]; }
+  size_t rowEnd(size_t i) const { return rowStarts_[i + 1]; }
+
+  /// Block column of entry \c k
+  size_t column(size_t k) const { return columns_[k]; }
+
+  /// Entry of block (i,j), or kNotFound
+  size_t find(size_t i, size_t j) const;
+
+  /// Block of entry \c k, which is in block row \c i
+  Eigen::Map<const Matrix> block(size_t i, size_t k) const {
+    return Eigen::Map<const Matrix>(values_.data() + blockOffsets_[k], dim(i),
+                                    dim(columns_[k]));
+  }
+
+  /// Mutable block of entry \c k, which is in block row \c i
+  Eigen::Map<Matrix> block(size_t i, size_t k) {
+    return Eigen::Map<Matrix>(values_.data() + blockOffsets_[k], dim(i),
+                              dim(columns_[k]));
+  }
+
+  /// The information vector A'b
+  const Vector& informationVector() const { return eta_; }
+
+  /// Compute y = H x
+  void multiply(const Vector& x, Vector& y) const;
+
+  /// Return H as a dense matrix, for testing
+  Matrix dense() const;
+
+ private:
+  /// Add A'A and A'b of a whitened, unconstrained Jacobian factor
+  void addJacobian(const JacobianFactor& factor,
+                   const std::vector<size_t>& indices);
+
+  /// Add the information of a Hessian factor, block by block
+  void addHessian(const HessianFactor& factor,
+                  const std::vector<size_t>& indices);
+
+  /// Add an augmented information matrix, for all other factor types
+  void addInformation(const Matrix& information,
+                      const std::vector<size_t>& indices);
+
+  boost::shared_ptr<const FlatVectorValues::Layout> layout_;  ///< Block rows
+  std::vector<size_t> rowStarts_;     ///< First entry of each block row
+  std::vector<size_t> columns_;       ///< Block column of each entry
+  std::vector<size_t> blockOffsets_;  ///< Start of each entry in values_
+  Vector values_;                     ///< All blocks, column-major
+  Vector eta_;                        ///< Information vector
+};
+
+}  // namespace gtsam
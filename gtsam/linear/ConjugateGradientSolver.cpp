@@ -33,7 +33,8 @@ void ConjugateGradientParameters::print(ostream &os) const {
         << "maxIter:       " << maxIterations_ << endl
         << "resetIter:     " << reset_ << endl
         << "eps_rel:       " << epsilon_rel_ << endl
-        << "eps_abs:       " << epsilon_abs_ << endl;
+        << "eps_abs:       " << epsilon_abs_ << endl
+        << "blasKernel:    " << blasTranslator(blas_kernel_) << endl;
 }
 
 /*****************************************************************************/
@@ -41,6 +42,7 @@ std::string ConjugateGradientParameters::blasTranslator(const BLASKernel value)
   std::string s;
   switch (value) {
   case ConjugateGradientParameters::GTSAM:      s = "GTSAM" ;      break;
+  case ConjugateGradientParameters::BSR:        s = "BSR" ;        break;
   default:                                      s = "UNDEFINED" ;  break;
   }
   return s;
@@ -51,6 +53,7 @@ ConjugateGradientParameters::BLASKernel ConjugateGradientParameters::blasTransla
     const std::string &src) {
   std::string s = src;  boost::algorithm::to_upper(s);
   if (s == "GTSAM")  return ConjugateGradientParameters::GTSAM;
+  if (s == "BSR")    return ConjugateGradientParameters::BSR;
 
   /* default is SBM */
   return ConjugateGradientParameters::GTSAM;
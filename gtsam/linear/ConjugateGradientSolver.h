@@ -41,6 +41,7 @@ public:
   /* Matrix Operation Kernel */
   enum BLASKernel {
     GTSAM = 0,        ///< Jacobian Factor Graph of GTSAM
+    BSR,              ///< Block sparse Hessian, see BlockSparseMatrix, used by PCGSolver
   } blas_kernel_ ;
 
   ConjugateGradientParameters()
@@ -54,7 +55,7 @@ public:
 
   ConjugateGradientParameters(const ConjugateGradientParameters &p)
     : Base(p), minIterations_(p.minIterations_), maxIterations_(p.maxIterations_), reset_(p.reset_),
-               epsilon_rel_(p.epsilon_rel_), epsilon_abs_(p.epsilon_abs_), blas_kernel_(GTSAM) {}
+               epsilon_rel_(p.epsilon_rel_), epsilon_abs_(p.epsilon_abs_), blas_kernel_(p.blas_kernel_) {}
 
   /* general interface */
   inline size_t minIterations() const { return minIterations_; }
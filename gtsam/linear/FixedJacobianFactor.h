@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FixedJacobianFactor.h
+ * @brief   JacobianFactor with a row count and variable dimensions known at
+ *          compile time
+ * @date    Oct 17, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/base/SymmetricBlockMatrix.h>
+
+#include <boost/make_shared.hpp>
+#include <boost/serialization/base_object.hpp>
+
+#include <array>
+#include <stdexcept>
+
+namespace gtsam {
+
+namespace internal {
+/// Sum of the dimensions DIMS
+template <int... DIMS>
+struct DimensionSum;
+template <>
+struct DimensionSum<> {
+  enum { value = 0 };
+};
+template <int D, int... DIMS>
+struct DimensionSum<D, DIMS...> {
+  enum { value = D + DimensionSum<DIMS...>::value };
+};
+
+/// Whether all dimensions DIMS are known at compile time
+template <int... DIMS>
+struct FixedDimensions;
+template <>
+struct FixedDimensions<> {
+  enum { value = true };
+};
+template <int D, int... DIMS>
+struct FixedDimensions<D, DIMS...> {
+  enum { value = D > 0 && FixedDimensions<DIMS...>::value };
+};
+}  // namespace internal
+
+/**
+ * A JacobianFactor with M rows on variables of dimensions DIMS, all known at
+ * compile time, e.g. the linearization of a BetweenFactor<Pose3> is a
+ * FixedJacobianFactor<6, 6, 6>, see NoiseModelFactor::linearizeFixedSize.
+ *
+ * [A b] is stored in the VerticalBlockMatrix of JacobianFactor, such that the
+ * factor is eliminated like any other, but it is created from a fixed-size
+ * matrix, and its error and Hessian update use fixed-size matrices.  As for
+ * other JacobianFactor types, serializing it through a base class pointer
+ * requires BOOST_CLASS_EXPORT of the instantiations used.
+ */
+template <int M, int... DIMS>
+class FixedJacobianFactor : public JacobianFactor {
+  static_assert(internal::FixedDimensions<M, DIMS...>::value,
+                "FixedJacobianFactor needs dimensions known at compile time");
+
+ public:
+  typedef FixedJacobianFactor This;
+  typedef JacobianFactor Base;
+  typedef boost::shared_ptr<This> shared_ptr;
+
+  enum {
+    Rows = M,
+    N = sizeof...(DIMS),
+    Cols = internal::DimensionSum<DIMS...>::value + 1  ///< including b
+  };
+
+  typedef Eigen::Matrix<double, M, Cols> AugmentedMatrix;
+
+  /// The dimensions of the variables
+  static std::array<DenseIndex, N> Dimensions() { return {{DIMS...}}; }
+
+  /// Default constructor, for serialization
+  FixedJacobianFactor() {}
+
+  /// Construct from the keys, in the order of DIMS, and [A b]
+  FixedJacobianFactor(const KeyVector& keys, const AugmentedMatrix& Ab,
+                      const SharedDiagonal& model = SharedDiagonal())
+      : Base(keys, Dimensions(), M, model) {
+    if (keys.size() != N)
+      throw std::invalid_argument(
+          "FixedJacobianFactor: number of keys does not match dimensions");
+    Ab_.matrix() = Ab;
+  }
+
+  virtual ~FixedJacobianFactor() {}
+
+  /// Clone, keeping the fixed-size type
+  virtual GaussianFactor::shared_ptr clone() const {
+    return boost::make_shared<This>(*this);
+  }
+
+  /// [A b] as a fixed-size matrix, only valid if isFixed()
+  Eigen::Map<const AugmentedMatrix> augmented() const {
+    return Eigen::Map<const AugmentedMatrix>(Ab_.matrix().data());
+  }
+
+  /// Whether [A b] still has its fixed shape, it may be changed in place
+  bool isFixed() const {
+    return Ab_.matrix().rows() == M && Ab_.matrix().cols() == Cols &&
+           Ab_.rowStart() == 0 && Ab_.rowEnd() == M && Ab_.firstBlock() == 0;
+  }
+
+  /// 0.5*|A*x-b|^2, whitened by the model, with fixed-size vectors
+  virtual double error(const VectorValues& c) const {
+    if (!isFixed() || (model_ && model_->isConstrained()))
+      return Base::error(c);
+    const auto Ab = augmented();
+    Eigen::Matrix<double, M, 1> e = -Ab.col(Cols - 1);
+    const std::array<DenseIndex, N> dims = Dimensions();
+    for (DenseIndex j = 0, offset = 0; j < N; offset += dims[j++])
+      e.noalias() += Ab.middleCols(offset, dims[j]) * c[keys_[j]];
+    if (model_) e.array() *= model_->invsigmas().array();
+    return 0.5 * e.squaredNorm();
+  }
+
+  /// Add A'A to \c info, computed as one fixed-size product
+  void updateHessian(const KeyVector& infoKeys,
+                     SymmetricBlockMatrix* info) const {
+    if (!isFixed() || (model_ && model_->isConstrained())) {
+      Base::updateHessian(infoKeys, info);
+      return;
+    }
+    AugmentedMatrix Ab = augmented();
+    if (model_ && !model_->isUnit())
+      Ab = model_->invsigmas().asDiagonal() * Ab;
+    Eigen::Matrix<double, Cols, Cols> H;
+    H.noalias() = Ab.transpose() * Ab;
+
+    // Scatter the blocks of H, the last one being that of b
+    const std::array<DenseIndex, N> dims = Dimensions();
+    std::array<DenseIndex, N + 1> slots, offsets, sizes;
+    for (DenseIndex j = 0, offset = 0; j <= N; ++j) {
+      slots[j] = j < N ? Slot(infoKeys, keys_[j]) : info->nBlocks() - 1;
+      sizes[j] = j < N ? dims[j] : 1;
+      offsets[j] = offset;
+      offset += sizes[j];
+    }
+    for (DenseIndex j = 0; j <= N; ++j) {
+      for (DenseIndex i = 0; i < j; ++i)
+        info->updateOffDiagonalBlock(
+            slots[i], slots[j],
+            H.block(offsets[i], offsets[j], sizes[i], sizes[j]));
+      info->updateDiagonalBlock(
+          slots[j], H.block(offsets[j], offsets[j], sizes[j], sizes[j]));
+    }
+  }
+
+ private:
+  /** Serialization function */
+  friend class boost::serialization::access;
+  template <class ARCHIVE>
+  void serialize(ARCHIVE& ar, const unsigned int /*version*/) {
+    ar& boost::serialization::make_nvp(
+        "JacobianFactor", boost::serialization::base_object<Base>(*this));
+  }
+};
+
+/// traits
+template <int M, int... DIMS>
+struct traits<FixedJacobianFactor<M, DIMS...> >
+    : public Testable<FixedJacobianFactor<M, DIMS...> > {};
+
+}  // namespace gtsam
@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FlatVectorValues.cpp
+ * @brief   VectorValues stored in a single contiguous vector
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/FlatVectorValues.h>
+
+#include <boost/make_shared.hpp>
+
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+FlatVectorValues::Layout::Layout(const Scatter& _scatter)
+    : scatter(_scatter), dim(0) {
+  offsets.reserve(scatter.size());
+  for (const SlotEntry& entry : scatter) {
+    offsets.push_back(dim);
+    if (!slots.emplace(entry.key, Slot(dim, entry.dimension)).second)
+      throw invalid_argument("FlatVectorValues: duplicate variable '" +
+                             DefaultKeyFormatter(entry.key) + "'");
+    dim += entry.dimension;
+  }
+}
+
+/* ************************************************************************* */
+FlatVectorValues::FlatVectorValues() {
+  static const boost::shared_ptr<const Layout> empty =
+      boost::make_shared<Layout>(Scatter());
+  layout_ = empty;
+}
+
+/* ************************************************************************* */
+FlatVectorValues::FlatVectorValues(const VectorValues& values) {
+  Scatter scatter;
+  scatter.reserve(values.size());
+  for (const VectorValues::KeyValuePair& key_value : values)
+    scatter.emplace_back(key_value.first, key_value.second.size());
+  layout_ = boost::make_shared<Layout>(scatter);
+
+  data_.resize(layout_->dim);
+  DenseIndex offset = 0;
+  for (const VectorValues::KeyValuePair& key_value : values) {
+    data_.segment(offset, key_value.second.size()) = key_value.second;
+    offset += key_value.second.size();
+  }
+}
+
+/* ************************************************************************* */
+FlatVectorValues::FlatVectorValues(const Vector& x, const Scatter& scatter)
+    : layout_(boost::make_shared<Layout>(scatter)), data_(x) {
+  if (data_.size() != layout_->dim)
+    throw invalid_argument(
+        "FlatVectorValues: vector size does not match the total dimension");
+}
+
+/* ************************************************************************* */
+FlatVectorValues::FlatVectorValues(const boost::shared_ptr<const Layout>& layout)
+    : layout_(layout), data_(Vector::Zero(layout->dim)) {}
+
+/* ************************************************************************* */
+FlatVectorValues FlatVectorValues::Zero(const FlatVectorValues& other) {
+  FlatVectorValues result;
+  result.layout_ = other.layout_;
+  result.data_ = Vector::Zero(other.data_.size());
+  return result;
+}
+
+/* ************************************************************************* */
+const FlatVectorValues::Slot& FlatVectorValues::slot(Key j) const {
+  FastMap<Key, Slot>::const_iterator item = layout_->slots.find(j);
+  if (item == layout_->slots.end())
+    throw out_of_range("Requested variable '" + DefaultKeyFormatter(j) +
+                       "' is not in this FlatVectorValues.");
+  return item->second;
+}
+
+/* ************************************************************************* */
+VectorValues FlatVectorValues::vectorValues() const {
+  return VectorValues(data_, layout_->scatter);
+}
+
+/* ************************************************************************* */
+bool FlatVectorValues::hasSameStructure(const FlatVectorValues& other) const {
+  if (layout_ == other.layout_) return true;
+  const Scatter& a = layout_->scatter;
+  const Scatter& b = other.layout_->scatter;
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i)
+    if (a[i].key != b[i].key || a[i].dimension != b[i].dimension) return false;
+  return true;
+}
+
+/* ************************************************************************* */
+void FlatVectorValues::checkStructure(const FlatVectorValues& other,
+                                      const char* operation) const {
+  if (!hasSameStructure(other))
+    throw invalid_argument(string("FlatVectorValues::") + operation +
+                           " called with a FlatVectorValues of different structure");
+}
+
+/* ************************************************************************* */
+void FlatVectorValues::print(const string& str,
+                             const KeyFormatter& formatter) const {
+  cout << str << ": " << size() << " elements\n";
+  for (const SlotEntry& entry : layout_->scatter)
+    cout << "  " << formatter(entry.key) << ": "
+         << at(entry.key).transpose() << "\n";
+  cout.flush();
+}
+
+/* ************************************************************************* */
+bool FlatVectorValues::equals(const FlatVectorValues& x, double tol) const {
+  return hasSameStructure(x) && equal_with_abs_tol(data_, x.data_, tol);
+}
+
+/* ************************************************************************* */
+double FlatVectorValues::dot(const FlatVectorValues& v) const {
+  checkStructure(v, "dot");
+  return data_.dot(v.data_);
+}
+
+/* ************************************************************************* */
+FlatVectorValues FlatVectorValues::operator+(const FlatVectorValues& c) const {
+  checkStructure(c, "operator+");
+  FlatVectorValues result;
+  result.layout_ = layout_;
+  result.data_ = data_ + c.data_;
+  return result;
+}
+
+/* ************************************************************************* */
+FlatVectorValues FlatVectorValues::operator-(const FlatVectorValues& c) const {
+  checkStructure(c, "operator-");
+  FlatVectorValues result;
+  result.layout_ = layout_;
+  result.data_ = data_ - c.data_;
+  return result;
+}
+
+/* ************************************************************************* */
+FlatVectorValues& FlatVectorValues::operator+=(const FlatVectorValues& c) {
+  checkStructure(c, "operator+=");
+  data_ += c.data_;
+  return *this;
+}
+
+/* ************************************************************************* */
+FlatVectorValues& FlatVectorValues::operator-=(const FlatVectorValues& c) {
+  checkStructure(c, "operator-=");
+  data_ -= c.data_;
+  return *this;
+}
+
+/* ************************************************************************* */
+FlatVectorValues& FlatVectorValues::axpy(double alpha,
+                                         const FlatVectorValues& x) {
+  checkStructure(x, "axpy");
+  data_ += alpha * x.data_;
+  return *this;
+}
+
+/* ************************************************************************* */
+FlatVectorValues operator*(double a, const FlatVectorValues& v) {
+  FlatVectorValues result;
+  result.layout_ = v.layout_;
+  result.data_ = a * v.data_;
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FlatVectorValues.h
+ * @brief   VectorValues stored in a single contiguous vector
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/Scatter.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/Vector.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A collection of vector-valued variables, like VectorValues, but stored in one
+ * contiguous Vector together with a key -> offset index. Linear algebra
+ * operations (dot, norm, axpy, scaling) are then single passes over the buffer
+ * that Eigen vectorizes, rather than one small heap-allocated Vector per
+ * variable.
+ *
+ * The layout (the order and dimensions of the variables) is immutable and
+ * shared between copies, and between FlatVectorValues created with Zero(), so
+ * that structure checks in binary operations are a pointer comparison in the
+ * common case. Variables can not be inserted or erased after construction.
+ *
+ * Typical use is to convert a VectorValues once, with
+ * FlatVectorValues(const VectorValues&), run an iterative method on it, and
+ * convert back with vectorValues(), or retract a Values with it directly.
+ * \nosubgrouping
+ */
+class GTSAM_EXPORT FlatVectorValues {
+ public:
+  typedef boost::shared_ptr<FlatVectorValues> shared_ptr;
+
+  /// Position of one variable in the contiguous vector
+  struct Slot {
+    DenseIndex offset;
+    size_t dim;
+    Slot(DenseIndex _offset, size_t _dim) : offset(_offset), dim(_dim) {}
+  };
+
+  /// The layout shared by FlatVectorValues with the same structure
+  struct Layout {
+    Scatter scatter;             ///< Keys and dimensions, in storage order
+    std::vector<DenseIndex> offsets;  ///< Offset of each variable, in storage order
+    FastMap<Key, Slot> slots;    ///< Key -> position in the vector
+    DenseIndex dim;              ///< Total dimension
+
+    /// Build the layout from keys and dimensions, in order
+    explicit Layout(const Scatter& scatter);
+  };
+
+ private:
+  boost::shared_ptr<const Layout> layout_;
+  Vector data_;
+
+  /// Find the slot of key j, or throw std::out_of_range
+  const Slot& slot(Key j) const;
+
+ public:
+  /// @name Standard Constructors
+  /// @{
+
+  /// Default constructor creates an empty FlatVectorValues
+  FlatVectorValues();
+
+  /// Copy the variables of a VectorValues, stored in key order
+  explicit FlatVectorValues(const VectorValues& values);
+
+  /// Construct from a vector, with keys and dimensions given by scatter
+  FlatVectorValues(const Vector& x, const Scatter& scatter);
+
+  /// Create a FlatVectorValues with a given (shared) layout, filled with zeros
+  explicit FlatVectorValues(const boost::shared_ptr<const Layout>& layout);
+
+  /// Create a FlatVectorValues with the same layout as \c other, filled with zeros
+  static FlatVectorValues Zero(const FlatVectorValues& other);
+
+  /// @}
+  /// @name Standard Interface
+  /// @{
+
+  /// Number of variables stored
+  size_t size() const { return layout_->scatter.size(); }
+
+  /// Total dimension, i.e., the size of the contiguous vector
+  size_t dim() const { return data_.size(); }
+
+  /// Return the dimension of variable \c j
+  size_t dim(Key j) const { return slot(j).dim; }
+
+  /// Check whether a variable with key \c j exists
+  bool exists(Key j) const { return layout_->slots.count(j) > 0; }
+
+  /// Read/write view on the value of variable \c j, throws std::out_of_range
+  /// if \c j does not exist
+  SubVector at(Key j) {
+    const Slot& s = slot(j);
+    return data_.segment(s.offset, s.dim);
+  }
+
+  /// Read-only view on the value of variable \c j, throws std::out_of_range
+  /// if \c j does not exist
+  ConstSubVector at(Key j) const {
+    const Slot& s = slot(j);
+    return data_.segment(s.offset, s.dim);
+  }
+
+  /// Identical to at(Key)
+  SubVector operator[](Key j) { return at(j); }
+
+  /// Identical to at(Key)
+  ConstSubVector operator[](Key j) const { return at(j); }
+
+  /// Keys and dimensions of the variables, in storage order
+  const Scatter& scatter() const { return layout_->scatter; }
+
+  /// The layout, which can be shared with other FlatVectorValues
+  const boost::shared_ptr<const Layout>& layout() const { return layout_; }
+
+  /// The contiguous vector holding all variables, in storage order
+  const Vector& vector() const { return data_; }
+
+  /// Read/write access to the contiguous vector
+  Vector& vector() { return data_; }
+
+  /// Convert to a VectorValues
+  VectorValues vectorValues() const;
+
+  /// Set all values to zero
+  void setZero() { data_.setZero(); }
+
+  /// Check if this FlatVectorValues has the same keys and dimensions, in the
+  /// same order, as another
+  bool hasSameStructure(const FlatVectorValues& other) const;
+
+  /// print required by Testable for unit testing
+  void print(const std::string& str = "FlatVectorValues",
+             const KeyFormatter& formatter = DefaultKeyFormatter) const;
+
+  /// equals required by Testable for unit testing
+  bool equals(const FlatVectorValues& x, double tol = 1e-9) const;
+
+  /// @}
+  /// @name Linear algebra operations
+  /// @{
+  /// All binary operations require both arguments to have the same structure,
+  /// and throw std::invalid_argument otherwise.
+
+  /// Dot product with another FlatVectorValues
+  double dot(const FlatVectorValues& v) const;
+
+  /// Vector L2 norm
+  double norm() const { return data_.norm(); }
+
+  /// Squared vector L2 norm
+  double squaredNorm() const { return data_.squaredNorm(); }
+
+  /// Element-wise addition
+  FlatVectorValues operator+(const FlatVectorValues& c) const;
+
+  /// Element-wise subtraction
+  FlatVectorValues operator-(const FlatVectorValues& c) const;
+
+  /// Element-wise addition in-place
+  FlatVectorValues& operator+=(const FlatVectorValues& c);
+
+  /// Element-wise subtraction in-place
+  FlatVectorValues& operator-=(const FlatVectorValues& c);
+
+  /// this += alpha * x, in a single pass
+  FlatVectorValues& axpy(double alpha, const FlatVectorValues& x);
+
+  /// Element-wise scaling by a constant
+  friend GTSAM_EXPORT FlatVectorValues operator*(double a,
+                                                 const FlatVectorValues& v);
+
+  /// Element-wise scaling by a constant in-place
+  FlatVectorValues& operator*=(double alpha) {
+    data_ *= alpha;
+    return *this;
+  }
+
+  /// @}
+
+ private:
+  /// Throw std::invalid_argument if other has a different structure
+  void checkStructure(const FlatVectorValues& other, const char* operation) const;
+};
+
+/// BLAS Level 1 axpy: y <- alpha*x + y, used by the iterative solvers
+inline void axpy(double alpha, const FlatVectorValues& x, FlatVectorValues& y) {
+  y.axpy(alpha, x);
+}
+
+/// traits
+template <>
+struct traits<FlatVectorValues> : public Testable<FlatVectorValues> {};
+
+}  // namespace gtsam
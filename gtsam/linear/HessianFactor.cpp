@@ -22,6 +22,7 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/linearExceptions.h>
+#include <gtsam/base/Arena.h>
 #include <gtsam/base/cholesky.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/FastMap.h>
@@ -363,6 +364,24 @@ void HessianFactor::updateHessian(const KeyVector& infoKeys,
   // Apply updates to the upper triangle
   DenseIndex nrVariablesInThisFactor = size(), nrBlocksInInfo = info->nBlocks() - 1;
   vector<DenseIndex> slots(nrVariablesInThisFactor + 1);
+
+  // Blocks of equal, common size are added with fixed-size kernels
+  DenseIndex d = nrVariablesInThisFactor > 0 ? info_.getDim(0) : 0;
+  for (DenseIndex j = 1; j < nrVariablesInThisFactor; ++j)
+    if (info_.getDim(j) != d) d = 0;
+  if (d == 2 || d == 3 || d == 6 || d == 9) {
+    for (DenseIndex j = 0; j < nrVariablesInThisFactor; ++j)
+      slots[j] = Slot(infoKeys, keys_[j]);
+    slots[nrVariablesInThisFactor] = nrBlocksInInfo;
+    switch (d) {
+      case 2: info->updateFromSymmetric<2>(info_, slots); break;
+      case 3: info->updateFromSymmetric<3>(info_, slots); break;
+      case 6: info->updateFromSymmetric<6>(info_, slots); break;
+      case 9: info->updateFromSymmetric<9>(info_, slots); break;
+    }
+    return;
+  }
+
   // Loop over this factor's blocks with indices (i,j)
   // For every block (i,j), we determine the block (I,J) in info.
   for (DenseIndex j = 0; j <= nrVariablesInThisFactor; ++j) {
@@ -482,7 +501,7 @@ boost::shared_ptr<GaussianConditional> HessianFactor::eliminateCholesky(const Or
 
     // TODO(frank): pre-allocate GaussianConditional and write into it
     const VerticalBlockMatrix Ab = info_.split(nFrontals);
-    conditional = boost::make_shared<GaussianConditional>(keys_, nFrontals, Ab);
+    conditional = allocateShared<GaussianConditional>(keys_, nFrontals, Ab);
 
     // Erase the eliminated keys in this factor
     keys_.erase(begin(), begin() + nFrontals);
@@ -534,7 +553,7 @@ EliminateCholesky(const GaussianFactorGraph& factors, const Ordering& keys) {
   HessianFactor::shared_ptr jointFactor;
   try {
     Scatter scatter(factors, keys);
-    jointFactor = boost::make_shared<HessianFactor>(factors, scatter);
+    jointFactor = allocateShared<HessianFactor>(factors, scatter);
   } catch (std::invalid_argument&) {
     throw InvalidDenseElimination(
         "EliminateCholesky was called with a request to eliminate variables that are not\n"
@@ -25,6 +25,7 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/inference/VariableSlots.h>
 #include <gtsam/inference/Ordering.h>
+#include <gtsam/base/Arena.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/timing.h>
 #include <gtsam/base/Matrix.h>
@@ -576,6 +577,22 @@ map<Key, Matrix> JacobianFactor::hessianBlockDiagonal() const {
   return blocks;
 }
 
+/* ************************************************************************* */
+namespace {
+// Add A'A with the fixed-size kernel for variable blocks of width d
+template <typename MATRIX>
+void updateHessianFixed(DenseIndex d, const MATRIX& Ab,
+                        const vector<DenseIndex>& slots,
+                        SymmetricBlockMatrix* info) {
+  switch (d) {
+    case 2: info->updateFromAugmentedJacobian<2>(Ab, slots); break;
+    case 3: info->updateFromAugmentedJacobian<3>(Ab, slots); break;
+    case 6: info->updateFromAugmentedJacobian<6>(Ab, slots); break;
+    case 9: info->updateFromAugmentedJacobian<9>(Ab, slots); break;
+  }
+}
+}  // namespace
+
 /* ************************************************************************* */
 void JacobianFactor::updateHessian(const KeyVector& infoKeys,
                                    SymmetricBlockMatrix* info) const {
@@ -583,18 +600,40 @@ void JacobianFactor::updateHessian(const KeyVector& infoKeys,
 
   if (rows() == 0) return;
 
-  // Whiten the factor if it has a noise model
   const SharedDiagonal& model = get_model();
-  if (model && !model->isUnit()) {
-    if (model->isConstrained())
-      throw invalid_argument(
-          "JacobianFactor::updateHessian: cannot update information with "
-          "constrained noise model");
+  const bool whitened = model && !model->isUnit();
+  if (whitened && model->isConstrained())
+    throw invalid_argument(
+        "JacobianFactor::updateHessian: cannot update information with "
+        "constrained noise model");
+
+  // Variable blocks of equal, common width, e.g. Pose3 or Point3 factors, are
+  // added with fixed-size kernels, whitening only a copy of the matrix
+  const DenseIndex n = Ab_.nBlocks() - 1;
+  DenseIndex d = n > 0 ? Ab_(0).cols() : 0;
+  for (DenseIndex j = 1; j < n; ++j)
+    if (Ab_(j).cols() != d) d = 0;
+  if (d == 2 || d == 3 || d == 6 || d == 9) {
+    vector<DenseIndex> slots(n + 1);
+    for (DenseIndex j = 0; j < n; ++j) slots[j] = Slot(infoKeys, keys_[j]);
+    slots[n] = info->nBlocks() - 1;
+    if (whitened) {
+      Matrix Ab = Ab_.full();
+      model->WhitenInPlace(Ab);
+      updateHessianFixed(d, Ab, slots, info);
+    } else {
+      updateHessianFixed(d, Ab_.full(), slots, info);
+    }
+    return;
+  }
+
+  // Whiten the factor if it has a noise model
+  if (whitened) {
     JacobianFactor whitenedFactor = whiten();
     whitenedFactor.updateHessian(infoKeys, info);
   } else {
     // Ab_ is the augmented Jacobian matrix A, and we perform I += A'*A below
-    DenseIndex n = Ab_.nBlocks() - 1, N = info->nBlocks() - 1;
+    const DenseIndex N = info->nBlocks() - 1;
 
     // Apply updates to the upper triangle
     // Loop over blocks of A, including RHS with j==n
@@ -798,7 +837,7 @@ std::pair<GaussianConditional::shared_ptr, JacobianFactor::shared_ptr> Eliminate
   // Combine and sort variable blocks in elimination order
   JacobianFactor::shared_ptr jointFactor;
   try {
-    jointFactor = boost::make_shared<JacobianFactor>(factors, keys);
+    jointFactor = allocateShared<JacobianFactor>(factors, keys);
   } catch (std::invalid_argument&) {
     throw InvalidDenseElimination(
         "EliminateQR was called with a request to eliminate variables that are not\n"
@@ -861,7 +900,7 @@ GaussianConditional::shared_ptr JacobianFactor::splitConditional(size_t nrFronta
   conditionalNoiseModel =
       noiseModel::Diagonal::Sigmas(model_->sigmas().segment(Ab_.rowStart(), Ab_.rows()));
   GaussianConditional::shared_ptr conditional =
-      boost::make_shared<GaussianConditional>(Base::keys_, nrFrontals, Ab_, conditionalNoiseModel);
+      allocateShared<GaussianConditional>(Base::keys_, nrFrontals, Ab_, conditionalNoiseModel);
 
   const DenseIndex maxRemainingRows =
       std::min(Ab_.cols(), originalRowEnd) - Ab_.rowStart() - frontalDim;
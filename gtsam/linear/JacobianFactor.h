@@ -388,6 +388,8 @@ namespace gtsam {
       const GaussianFactorGraph& graph,
       const FastVector<VariableSlots::const_iterator>& orderedSlots);
 
+  protected:
+
     /** Unsafe Constructor that creates an uninitialized Jacobian of right size
      *  @param keys in some order
      *  @param diemnsions of the variables in same order
@@ -400,6 +402,8 @@ namespace gtsam {
         Base(keys), Ab_(dims.begin(), dims.end(), m, true), model_(model) {
     }
 
+  private:
+
     // be very selective on who can access these private methods:
     template<typename T> friend class ExpressionFactor;
 
@@ -18,11 +18,14 @@
  */
 
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/BlockSparseMatrix.h>
+#include <gtsam/linear/FlatVectorValues.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/VectorValues.h>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/make_shared.hpp>
 
 #include <algorithm>
 #include <iostream>
@@ -49,23 +52,43 @@ PCGSolver::PCGSolver(const PCGSolverParameters &p) {
 VectorValues PCGSolver::optimize(const GaussianFactorGraph &gfg,
     const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda,
     const VectorValues &initial) {
-  /* build preconditioner */
-  preconditioner_->build(gfg, keyInfo, lambda);
-
   /* apply pcg */
-  GaussianFactorGraphSystem system(gfg, *preconditioner_, keyInfo, lambda);
   Vector x0 = initial.vector(keyInfo.ordering());
-  const Vector sol = preconditionedConjugateGradient(system, x0, parameters_);
+  if (parameters_.blas_kernel_ == ConjugateGradientParameters::BSR) {
+    /* assemble the Hessian once, for both the preconditioner and the products,
+     * and iterate on the contiguous solution in the order of keyInfo */
+    const BlockSparseMatrix hessian(gfg, keyInfo);
+    preconditioner_->buildWithHessian(gfg, keyInfo, lambda, hessian);
+    BlockSparseSystem system(hessian, *preconditioner_);
+    FlatVectorValues sol(hessian.layout());
+    sol.vector() = preconditionedConjugateGradient(system, x0, parameters_);
+    return sol.vectorValues();
+  }
 
+  /* build preconditioner */
+  preconditioner_->build(gfg, keyInfo, lambda);
+  HessianBatch::shared_ptr batch;
+  if (parameters_.hessianBatch_)
+    batch = parameters_.hessianBatch_(gfg);
+  GaussianFactorGraphSystem system(gfg, *preconditioner_, keyInfo, lambda,
+      batch);
+  const Vector sol = preconditionedConjugateGradient(system, x0, parameters_);
   return buildVectorValues(sol, keyInfo);
 }
 
 /*****************************************************************************/
 GaussianFactorGraphSystem::GaussianFactorGraphSystem(
     const GaussianFactorGraph &gfg, const Preconditioner &preconditioner,
-    const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda) :
+    const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda,
+    const HessianBatch::shared_ptr &batch) :
     gfg_(gfg), preconditioner_(preconditioner), keyInfo_(keyInfo), lambda_(
-        lambda) {
+        lambda), batch_(batch) {
+  if (batch_) {
+    others_ = boost::make_shared<GaussianFactorGraph>();
+    for (const GaussianFactor::shared_ptr &factor : gfg_)
+      if (factor && !batch_->covers(*factor))
+        others_->push_back(factor);
+  }
 }
 
 /*****************************************************************************/
@@ -92,7 +115,12 @@ void GaussianFactorGraphSystem::multiply(const Vector &x, Vector& AtAx) const {
   VectorValues vvAtAx = keyInfo_.x0(); // crucial for performance
 
   // vvAtAx += 1.0 * A'Ax for each factor
-  gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
+  if (batch_) {
+    batch_->multiplyHessianAdd(1.0, vvX, vvAtAx);
+    others_->multiplyHessianAdd(1.0, vvX, vvAtAx);
+  } else {
+    gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
+  }
 
   // Make the result as Vector form
   AtAx = vvAtAx.vector(keyInfo_.ordering());
@@ -125,6 +153,40 @@ void GaussianFactorGraphSystem::rightPrecondition(const Vector &x,
   preconditioner_.transposeSolve(x, y);
 }
 
+/*****************************************************************************/
+BlockSparseSystem::BlockSparseSystem(const BlockSparseMatrix &hessian,
+    const Preconditioner &preconditioner) :
+    hessian_(hessian), preconditioner_(preconditioner) {
+}
+
+/*****************************************************************************/
+void BlockSparseSystem::residual(const Vector &x, Vector &r) const {
+  /* implement b-Ax, assume x and r are pre-allocated */
+  Vector Ax;
+  hessian_.multiply(x, Ax);
+  r = hessian_.informationVector() - Ax;
+}
+
+/*****************************************************************************/
+void BlockSparseSystem::multiply(const Vector &x, Vector& AtAx) const {
+  hessian_.multiply(x, AtAx);
+}
+
+/*****************************************************************************/
+void BlockSparseSystem::getb(Vector &b) const {
+  b = hessian_.informationVector();
+}
+
+/**********************************************************************************/
+void BlockSparseSystem::leftPrecondition(const Vector &x, Vector &y) const {
+  preconditioner_.solve(x, y);
+}
+
+/**********************************************************************************/
+void BlockSparseSystem::rightPrecondition(const Vector &x, Vector &y) const {
+  preconditioner_.transposeSolve(x, y);
+}
+
 /**********************************************************************************/
 VectorValues buildVectorValues(const Vector &v, const Ordering &ordering,
     const map<Key, size_t> & dimensions) {
@@ -20,16 +20,39 @@
 #pragma once
 
 #include <gtsam/linear/ConjugateGradientSolver.h>
+#include <boost/function.hpp>
 #include <string>
 
 namespace gtsam {
 
+class BlockSparseMatrix;
+class GaussianFactor;
 class GaussianFactorGraph;
 class KeyInfo;
 class Preconditioner;
 class VectorValues;
 struct PreconditionerParameters;
 
+/**
+ * Computes the Hessian-vector products y += alpha*A'A*x of a subset of the
+ * factors of a graph at once, e.g., RegularImplicitSchurBatch.
+ * GaussianFactorGraphSystem uses it for the factors it covers, and multiplies
+ * all other factors one by one.
+ */
+class GTSAM_EXPORT HessianBatch {
+public:
+  typedef boost::shared_ptr<HessianBatch> shared_ptr;
+
+  virtual ~HessianBatch() {}
+
+  /// Whether \c factor is one of the factors of the batch
+  virtual bool covers(const GaussianFactor& factor) const = 0;
+
+  /// y += alpha*A'A*x, summed over the factors of the batch
+  virtual void multiplyHessianAdd(double alpha, const VectorValues& x,
+      VectorValues& y) const = 0;
+};
+
 /**
  * Parameters for PCG
  */
@@ -38,6 +61,10 @@ public:
   typedef ConjugateGradientParameters Base;
   typedef boost::shared_ptr<PCGSolverParameters> shared_ptr;
 
+  /// Creates a HessianBatch for (part of) a graph, or returns null
+  typedef boost::function<HessianBatch::shared_ptr(const GaussianFactorGraph&)>
+      HessianBatchFactory;
+
   PCGSolverParameters() {
   }
 
@@ -49,6 +76,11 @@ public:
   }
 
   boost::shared_ptr<PreconditionerParameters> preconditioner_;
+
+  /* if set, called on every linear system to batch the products of the
+   * factors it recognizes, e.g., RegularImplicitSchurBatch<CAMERA>::Create.
+   * Not used with the BSR kernel, which assembles the Hessian instead. */
+  HessianBatchFactory hessianBatch_;
 };
 
 /**
@@ -84,14 +116,49 @@ public:
 class GTSAM_EXPORT GaussianFactorGraphSystem {
 public:
 
+  /// With a \c batch, products of the factors it covers are batched
   GaussianFactorGraphSystem(const GaussianFactorGraph &gfg,
       const Preconditioner &preconditioner, const KeyInfo &info,
-      const std::map<Key, Vector> &lambda);
+      const std::map<Key, Vector> &lambda,
+      const HessianBatch::shared_ptr &batch = HessianBatch::shared_ptr());
 
   const GaussianFactorGraph &gfg_;
   const Preconditioner &preconditioner_;
   const KeyInfo &keyInfo_;
   const std::map<Key, Vector> &lambda_;
+  HessianBatch::shared_ptr batch_;
+  boost::shared_ptr<GaussianFactorGraph> others_; /* factors not in batch_ */
+
+  void residual(const Vector &x, Vector &r) const;
+  void multiply(const Vector &x, Vector& y) const;
+  void leftPrecondition(const Vector &x, Vector &y) const;
+  void rightPrecondition(const Vector &x, Vector &y) const;
+  inline void scal(const double alpha, Vector &x) const {
+    x *= alpha;
+  }
+  inline double dot(const Vector &x, const Vector &y) const {
+    return x.dot(y);
+  }
+  inline void axpy(const double alpha, const Vector &x, Vector &y) const {
+    y += alpha * x;
+  }
+
+  void getb(Vector &b) const;
+};
+
+/**
+ * System class for calling preconditionedConjugateGradient on a Hessian
+ * assembled in block sparse row format, used by PCGSolver when the BLAS
+ * kernel is ConjugateGradientParameters::BSR.
+ */
+class GTSAM_EXPORT BlockSparseSystem {
+public:
+
+  BlockSparseSystem(const BlockSparseMatrix &hessian,
+      const Preconditioner &preconditioner);
+
+  const BlockSparseMatrix &hessian_;
+  const Preconditioner &preconditioner_;
 
   void residual(const Vector &x, Vector &r) const;
   void multiply(const Vector &x, Vector& y) const;
@@ -7,11 +7,13 @@
  */
 
 #include <gtsam/inference/FactorGraph-inst.h>
+#include <gtsam/linear/BlockSparseMatrix.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/linear/NoiseModel.h>
+#include <gtsam/linear/linearExceptions.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/map.hpp>
@@ -182,6 +184,104 @@ void BlockJacobiPreconditioner::clean() {
   }
 }
 
+/***************************************************************************************/
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(
+  const IncompleteCholeskyPreconditionerParameters &p)
+  : Base(), parameters_(p), shift_(0.0) {}
+
+/***************************************************************************************/
+IncompleteCholeskyPreconditioner::~IncompleteCholeskyPreconditioner() {}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::solve(const Vector& y, Vector &x) const {
+  /* forward substitution x = L^{-1} y, by block rows */
+  const BlockSparseMatrix &L = *factor_;
+  x = y;
+  for ( size_t i = 0 ; i < L.blockRows() ; ++i ) {
+    auto xi = x.segment(L.offset(i), L.dim(i));
+    size_t k = L.rowBegin(i);
+    for ( ; L.column(k) < i ; ++k )
+      xi.noalias() -= L.block(i, k) * x.segment(L.offset(L.column(k)), L.dim(L.column(k)));
+    L.block(i, k).triangularView<Eigen::Lower>().solveInPlace(xi);
+  }
+}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::transposeSolve(const Vector& y, Vector& x) const {
+  /* backward substitution x = L^{-T} y, scattering each solved block row */
+  const BlockSparseMatrix &L = *factor_;
+  x = y;
+  for ( size_t i = L.blockRows() ; i-- > 0 ; ) {
+    auto xi = x.segment(L.offset(i), L.dim(i));
+    const size_t diagonal = L.find(i, i);
+    L.block(i, diagonal).transpose().triangularView<Eigen::Upper>().solveInPlace(xi);
+    for ( size_t k = L.rowBegin(i) ; k < diagonal ; ++k )
+      x.segment(L.offset(L.column(k)), L.dim(L.column(k))).noalias() -=
+          L.block(i, k).transpose() * xi;
+  }
+}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::build(
+  const GaussianFactorGraph &gfg, const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda)
+{
+  buildWithHessian(gfg, keyInfo, lambda, BlockSparseMatrix(gfg, keyInfo));
+}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::buildWithHessian(
+  const GaussianFactorGraph &gfg, const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda,
+  const BlockSparseMatrix &hessian)
+{
+  double shift = 0.0;
+  for ( size_t attempt = 0 ; attempt < 20 ; ++attempt ) {
+    factor_ = boost::make_shared<BlockSparseMatrix>(hessian);
+    if ( factorize(shift) ) {
+      shift_ = shift;
+      if ( parameters_.verbosity() >= PreconditionerParameters::COMPLEXITY )
+        cout << "IncompleteCholeskyPreconditioner: " << factor_->nonZeroBlocks()
+             << " blocks, shift " << shift << endl;
+      return;
+    }
+    shift = (shift == 0.0) ? parameters_.initialShift_ : 10.0 * shift;
+  }
+  throw IndeterminantLinearSystemException(keyInfo.ordering().front());
+}
+
+/***************************************************************************************/
+bool IncompleteCholeskyPreconditioner::factorize(double shift) {
+  BlockSparseMatrix &L = *factor_;
+  for ( size_t i = 0 ; i < L.blockRows() ; ++i ) {
+    /* L_ij = (H_ij - sum_{m<j} L_im L_jm^T) L_jj^{-T}, over the pattern only */
+    size_t k = L.rowBegin(i);
+    for ( ; L.column(k) < i ; ++k ) {
+      const size_t j = L.column(k);
+      auto Lij = L.block(i, k);
+      const size_t diagonal = L.find(j, j);
+      size_t a = L.rowBegin(i), b = L.rowBegin(j);
+      while ( a < k && b < diagonal ) {
+        if ( L.column(a) < L.column(b) ) ++a;
+        else if ( L.column(b) < L.column(a) ) ++b;
+        else Lij.noalias() -= L.block(i, a++) * L.block(j, b++).transpose();
+      }
+      L.block(j, diagonal).transpose().triangularView<Eigen::Upper>()
+          .solveInPlace<Eigen::OnTheRight>(Lij);
+    }
+
+    /* L_ii = chol(H_ii - sum_{m<i} L_im L_im^T) */
+    auto Lii = L.block(i, k);
+    if ( shift > 0.0 )
+      Lii.diagonal() *= 1.0 + shift;
+    for ( size_t m = L.rowBegin(i) ; m < k ; ++m )
+      Lii.noalias() -= L.block(i, m) * L.block(i, m).transpose();
+    Eigen::LLT<Matrix> llt(Lii);
+    if ( llt.info() != Eigen::Success )
+      return false;
+    Lii = llt.matrixL();
+  }
+  return true;
+}
+
 /***************************************************************************************/
 boost::shared_ptr<Preconditioner> createPreconditioner(const boost::shared_ptr<PreconditionerParameters> parameters) {
 
@@ -191,6 +291,9 @@ boost::shared_ptr<Preconditioner> createPreconditioner(const boost::shared_ptr<P
   else if ( BlockJacobiPreconditionerParameters::shared_ptr blockJacobi = boost::dynamic_pointer_cast<BlockJacobiPreconditionerParameters>(parameters) ) {
     return boost::make_shared<BlockJacobiPreconditioner>();
   }
+  else if ( IncompleteCholeskyPreconditionerParameters::shared_ptr incompleteCholesky = boost::dynamic_pointer_cast<IncompleteCholeskyPreconditionerParameters>(parameters) ) {
+    return boost::make_shared<IncompleteCholeskyPreconditioner>(*incompleteCholesky);
+  }
   else if ( SubgraphPreconditionerParameters::shared_ptr subgraph = boost::dynamic_pointer_cast<SubgraphPreconditionerParameters>(parameters) ) {
     return boost::make_shared<SubgraphPreconditioner>(*subgraph);
   }
@@ -16,6 +16,7 @@
 
 namespace gtsam {
 
+class BlockSparseMatrix;
 class GaussianFactorGraph;
 class KeyInfo;
 class VectorValues;
@@ -89,6 +90,17 @@ public:
     const KeyInfo &info,
     const std::map<Key,Vector> &lambda
     ) = 0;
+
+  /// build/factorize the preconditioner, given the Hessian of gfg already
+  /// assembled in the layout of info; by default the Hessian is not used
+  virtual void buildWithHessian(
+    const GaussianFactorGraph &gfg,
+    const KeyInfo &info,
+    const std::map<Key,Vector> &lambda,
+    const BlockSparseMatrix &/*hessian*/
+    ) {
+    build(gfg, info, lambda);
+  }
 };
 
 /*******************************************************************************************/
@@ -153,6 +165,62 @@ protected:
   size_t nnz_;
 };
 
+/*******************************************************************************************/
+struct GTSAM_EXPORT IncompleteCholeskyPreconditionerParameters : public PreconditionerParameters {
+  typedef PreconditionerParameters Base;
+  typedef boost::shared_ptr<IncompleteCholeskyPreconditionerParameters> shared_ptr;
+  IncompleteCholeskyPreconditionerParameters(double initialShift = 1e-3)
+      : Base(), initialShift_(initialShift) {}
+  virtual ~IncompleteCholeskyPreconditionerParameters() {}
+
+  /* relative diagonal shift tried first when the factorization breaks down,
+   * it is multiplied by 10 until the factorization succeeds */
+  double initialShift_;
+};
+
+/*******************************************************************************************/
+/* Block incomplete Cholesky IC(0) preconditioner: L has the sparsity pattern of
+ * the lower triangle of the block sparse Hessian, see BlockSparseMatrix, and
+ * M = L*L^T. The factorization of a positive definite matrix can break down
+ * without fill-in, in which case it is retried with the diagonal blocks scaled
+ * by (1 + shift). */
+class GTSAM_EXPORT IncompleteCholeskyPreconditioner : public Preconditioner {
+public:
+  typedef Preconditioner Base;
+  IncompleteCholeskyPreconditioner(const IncompleteCholeskyPreconditionerParameters &p =
+                                       IncompleteCholeskyPreconditionerParameters());
+  virtual ~IncompleteCholeskyPreconditioner();
+
+  /* Computation Interfaces for raw vector */
+  virtual void solve(const Vector& y, Vector &x) const;
+  virtual void transposeSolve(const Vector& y, Vector& x) const ;
+  virtual void build(
+    const GaussianFactorGraph &gfg,
+    const KeyInfo &info,
+    const std::map<Key,Vector> &lambda
+    ) ;
+
+  /* factorize a copy of the assembled Hessian, instead of assembling it again */
+  virtual void buildWithHessian(
+    const GaussianFactorGraph &gfg,
+    const KeyInfo &info,
+    const std::map<Key,Vector> &lambda,
+    const BlockSparseMatrix &hessian
+    ) ;
+
+  /* the diagonal shift used by the last build, 0 if none was needed */
+  double shift() const { return shift_; }
+
+protected:
+
+  /* factorize factor_ in place with the given shift, false on breakdown */
+  bool factorize(double shift);
+
+  IncompleteCholeskyPreconditionerParameters parameters_;
+  boost::shared_ptr<BlockSparseMatrix> factor_; /* L in the lower triangle */
+  double shift_;
+};
+
 /*********************************************************************************************/
 /* factory method to create preconditioners */
 boost::shared_ptr<Preconditioner> createPreconditioner(const boost::shared_ptr<PreconditionerParameters> parameters);
@@ -183,6 +183,19 @@ public:
     return model_ ? model_->whiten(Ax) : Ax;
   }
 
+private:
+
+  /** Unsafe Constructor that creates an uninitialized Jacobian of right size,
+   *  see JacobianFactor */
+  template<class KEYS, class DIMENSIONS>
+  RegularJacobianFactor(const KEYS& keys, const DIMENSIONS& dims, DenseIndex m,
+      const SharedDiagonal& model = SharedDiagonal()) :
+      JacobianFactor(keys, dims, m, model) {
+  }
+
+  // be very selective on who can access these private methods:
+  template<typename T> friend class ExpressionFactor;
+
 };
 // end class RegularJacobianFactor
 
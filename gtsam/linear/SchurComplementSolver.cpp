@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SchurComplementSolver.cpp
+ * @brief   Eliminates landmarks in closed form, as in bundle adjustment
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SchurComplementSolver.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/ThreadPool.h>
+#include <gtsam/base/timing.h>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+SchurComplementSolver::SchurComplementSolver(const GaussianFactorGraph& gfg,
+                                             const KeyVector& candidates) {
+  gttic(SchurComplementSolver_eliminate);
+
+  // Candidates that share a factor with another one can not be eliminated
+  // on their own
+  FastMap<Key, bool> isCandidate;
+  for (Key key : candidates) isCandidate[key] = true;
+  for (const GaussianFactor::shared_ptr& factor : gfg) {
+    if (!factor) continue;
+    size_t count = 0;
+    for (Key key : factor->keys()) count += isCandidate.count(key);
+    if (count < 2) continue;
+    for (Key key : factor->keys()) {
+      auto it = isCandidate.find(key);
+      if (it != isCandidate.end()) it->second = false;
+    }
+  }
+
+  // The factors of every eliminated variable, the others are kept
+  FastMap<Key, size_t> index;
+  for (Key key : candidates) {
+    if (isCandidate.at(key) && index.emplace(key, eliminated_.size()).second)
+      eliminated_.push_back(key);
+  }
+  vector<GaussianFactorGraph> groups(eliminated_.size());
+  for (const GaussianFactor::shared_ptr& factor : gfg) {
+    if (!factor) continue;
+    bool kept = true;
+    for (Key key : factor->keys()) {
+      auto it = index.find(key);
+      if (it != index.end()) {
+        groups[it->second].push_back(factor);
+        kept = false;
+        break;
+      }
+    }
+    if (kept) reduced_.push_back(factor);
+  }
+
+  // Eliminate every variable from its own factors, each elimination only
+  // writes its own results
+  conditionals_.resize(eliminated_.size());
+  vector<GaussianFactor::shared_ptr> schurComplements(eliminated_.size());
+  auto eliminate = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const Ordering frontal(KeyVector{eliminated_[i]});
+      auto result = EliminatePreferCholesky(groups[i], frontal);
+      conditionals_[i] = result.first;
+      schurComplements[i] = result.second;
+    }
+  };
+#ifdef GTSAM_USE_THREAD_POOL
+  static const size_t grainSize = 16;
+  ThreadPool::Global().parallelFor(0, eliminated_.size(), eliminate, grainSize);
+#else
+  eliminate(0, eliminated_.size());
+#endif
+  for (const GaussianFactor::shared_ptr& factor : schurComplements)
+    if (factor && !factor->empty()) reduced_.push_back(factor);
+}
+
+/* ************************************************************************* */
+VectorValues SchurComplementSolver::backSubstitute(
+    const VectorValues& reducedSolution) const {
+  gttic(SchurComplementSolver_backSubstitute);
+  vector<Vector> solutions(eliminated_.size());
+  auto solve = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const VectorValues solution = conditionals_[i]->solve(reducedSolution);
+      solutions[i] = solution.at(eliminated_[i]);
+    }
+  };
+#ifdef GTSAM_USE_THREAD_POOL
+  static const size_t grainSize = 64;
+  ThreadPool::Global().parallelFor(0, eliminated_.size(), solve, grainSize);
+#else
+  solve(0, eliminated_.size());
+#endif
+
+  VectorValues result = reducedSolution;
+  for (size_t i = 0; i < eliminated_.size(); ++i)
+    result.insert(eliminated_[i], solutions[i]);
+  return result;
+}
+
+/* ************************************************************************* */
+VectorValues SchurComplementSolver::optimize() const {
+  return backSubstitute(reduced_.optimize(EliminatePreferCholesky));
+}
+
+}  // namespace gtsam
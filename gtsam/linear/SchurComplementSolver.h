@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SchurComplementSolver.h
+ * @brief   Eliminates landmarks in closed form, as in bundle adjustment
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianConditional.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Solves a GaussianFactorGraph by first eliminating a set of variables that
+ * do not share any factor, typically the landmarks of a bundle adjustment
+ * problem.  Every such variable only depends on the cameras that observe it,
+ * so it is eliminated on its own, with one small dense Cholesky, in parallel
+ * when GTSAM is built with the thread pool.  The Schur complements on the
+ * cameras, together with the factors that do not involve any landmark, form
+ * the reduced camera system, which is much smaller than the original one,
+ * and can be solved by any linear solver, e.g., sparse Cholesky or PCG.  The
+ * landmarks are then recovered by back-substitution, again in parallel.
+ *
+ * Candidates that share a factor with another candidate are not eliminated
+ * first, but are left in the reduced system.
+ */
+class GTSAM_EXPORT SchurComplementSolver {
+ public:
+  /// Eliminate the \c candidates of \c gfg that do not share a factor
+  SchurComplementSolver(const GaussianFactorGraph& gfg,
+                        const KeyVector& candidates);
+
+  /// The eliminated variables
+  const KeyVector& eliminated() const { return eliminated_; }
+
+  /// The reduced system on the remaining variables
+  const GaussianFactorGraph& reducedSystem() const { return reduced_; }
+
+  /// Solve the eliminated variables, given the solution of the reduced system
+  VectorValues backSubstitute(const VectorValues& reducedSolution) const;
+
+  /// Solve the reduced system with multifrontal Cholesky, and back-substitute
+  VectorValues optimize() const;
+
+ private:
+  KeyVector eliminated_;
+  std::vector<GaussianConditional::shared_ptr> conditionals_;
+  GaussianFactorGraph reduced_;
+};
+
+}  // namespace gtsam
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SparseInverse.cpp
+ * @brief   Recover many covariance blocks of a GaussianBayesTree at once
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SparseInverse.h>
+#include <gtsam/base/treeTraversal-inst.h>
+#include <gtsam/base/timing.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+CliqueCovariance::CliqueCovariance(const GaussianConditional& conditional,
+                                   const CliqueCovariance* parent)
+    : keys_(conditional.keys()) {
+  offsets_.reserve(keys_.size() + 1);
+  offsets_.push_back(0);
+  for (auto it = conditional.begin(); it != conditional.end(); ++it)
+    offsets_.push_back(offsets_.back() + conditional.getDim(it));
+  const size_t nrFrontals = conditional.nrFrontals();
+  const DenseIndex f = offsets_[nrFrontals], n = offsets_.back(), s = n - f;
+
+  // Square root information of the conditional, whitened if needed
+  Matrix R = conditional.R(), S = conditional.S();
+  if (conditional.get_model()) {
+    conditional.get_model()->WhitenInPlace(R);
+    conditional.get_model()->WhitenInPlace(S);
+  }
+  const Matrix Rinv =
+      R.triangularView<Eigen::Upper>().solve(Matrix::Identity(f, f));
+
+  covariance_.resize(n, n);
+  if (s == 0) {
+    covariance_ = Rinv * Rinv.transpose();
+    return;
+  }
+  if (!parent)
+    throw invalid_argument(
+        "CliqueCovariance: a clique with a separator needs the covariance "
+        "of its parent");
+
+  // Sigma_SS, from the parent
+  for (size_t i = nrFrontals; i < keys_.size(); i++) {
+    for (size_t j = nrFrontals; j < keys_.size(); j++) {
+      covariance_.block(offsets_[i], offsets_[j], offsets_[i + 1] - offsets_[i],
+                        offsets_[j + 1] - offsets_[j]) =
+          parent->block(keys_[i], keys_[j]);
+    }
+  }
+
+  const Matrix G = -Rinv * S;
+  const Matrix SigmaFS = G * covariance_.bottomRightCorner(s, s);
+  covariance_.topRightCorner(f, s) = SigmaFS;
+  covariance_.bottomLeftCorner(s, f) = SigmaFS.transpose();
+  covariance_.topLeftCorner(f, f) =
+      Rinv * Rinv.transpose() + SigmaFS * G.transpose();
+}
+
+/* ************************************************************************* */
+size_t CliqueCovariance::index(Key key) const {
+  const auto it = find(keys_.begin(), keys_.end(), key);
+  if (it == keys_.end())
+    throw out_of_range("CliqueCovariance: variable not in clique");
+  return it - keys_.begin();
+}
+
+/* ************************************************************************* */
+bool CliqueCovariance::contains(Key key) const {
+  return find(keys_.begin(), keys_.end(), key) != keys_.end();
+}
+
+/* ************************************************************************* */
+Matrix CliqueCovariance::block(Key i, Key j) const {
+  const size_t a = index(i), b = index(j);
+  return covariance_.block(offsets_[a], offsets_[b],
+                           offsets_[a + 1] - offsets_[a],
+                           offsets_[b + 1] - offsets_[b]);
+}
+
+/* ************************************************************************* */
+namespace {
+typedef FastMap<const GaussianBayesTreeClique*, CliqueCovariance::shared_ptr>
+    CovarianceSlots;
+
+/// Computes the covariance of the cliques that have a slot, from their
+/// parent's, which is passed down as traversal data
+struct CovarianceVisitor {
+  CovarianceSlots* slots;
+  const CliqueCovariance* operator()(
+      const GaussianBayesTreeClique::shared_ptr& clique,
+      const CliqueCovariance* parent) {
+    // Slots only exist for requested cliques and their ancestors, so the
+    // descendants of a clique without a slot do not need one either
+    const auto slot = slots->find(clique.get());
+    if (slot == slots->end()) return nullptr;
+    slot->second =
+        boost::make_shared<CliqueCovariance>(*clique->conditional(), parent);
+    return slot->second.get();
+  }
+};
+}  // namespace
+
+/* ************************************************************************* */
+SparseInverse::SparseInverse(const GaussianBayesTree& bayesTree) {
+  compute(bayesTree, nullptr);
+}
+
+/* ************************************************************************* */
+SparseInverse::SparseInverse(const GaussianBayesTree& bayesTree,
+                             const KeyVector& variables) {
+  compute(bayesTree, &variables);
+}
+
+/* ************************************************************************* */
+void SparseInverse::compute(const GaussianBayesTree& bayesTree,
+                            const KeyVector* variables) {
+  gttic(SparseInverse);
+
+  // Create the slots up front, such that the traversal only writes to them
+  CovarianceSlots slots;
+  if (variables) {
+    for (Key key : *variables) {
+      // Add the clique and its ancestors, up to the first one already added
+      GaussianBayesTreeClique::shared_ptr clique = bayesTree[key];
+      while (clique && slots.emplace(clique.get(), nullptr).second)
+        clique = clique->parent();
+    }
+  } else {
+    for (const auto& key_clique : bayesTree.nodes())
+      slots.emplace(key_clique.second.get(), nullptr);
+  }
+
+  CovarianceVisitor visitor = {&slots};
+  treeTraversal::no_op postVisitor;
+  const CliqueCovariance* rootData = nullptr;
+  treeTraversal::DepthFirstForestParallel(bayesTree, rootData, visitor,
+                                          postVisitor);
+
+  for (const auto& slot : slots)
+    for (Key key : slot.first->conditional()->frontals())
+      cliques_.emplace(key, slot.second);
+}
+
+/* ************************************************************************* */
+const CliqueCovariance& SparseInverse::clique(Key variable) const {
+  const auto it = cliques_.find(variable);
+  if (it == cliques_.end())
+    throw invalid_argument(
+        "SparseInverse: the covariance of the variable was not recovered");
+  return *it->second;
+}
+
+/* ************************************************************************* */
+Matrix SparseInverse::marginalCovariance(Key variable) const {
+  return clique(variable).block(variable, variable);
+}
+
+/* ************************************************************************* */
+Matrix SparseInverse::jointCovariance(Key i, Key j) const {
+  if (exists(i) && clique(i).contains(j)) return clique(i).block(i, j);
+  if (exists(j) && clique(j).contains(i)) return clique(j).block(i, j);
+  throw invalid_argument("SparseInverse: the variables do not share a clique");
+}
+
+}  // namespace gtsam
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SparseInverse.h
+ * @brief   Recover many covariance blocks of a GaussianBayesTree at once
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianBayesTree.h>
+#include <gtsam/linear/GaussianConditional.h>
+#include <gtsam/base/FastMap.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The joint covariance of the variables of one clique, its frontal variables
+ * followed by its separator.  The conditional p(F|S) of the clique gives
+ * x_F = R^{-1} (d - S x_S), hence, with G = -R^{-1} S,
+ *   Sigma_FS = G Sigma_SS,  Sigma_FF = R^{-1} R^{-T} + Sigma_FS G^T,
+ * where Sigma_SS is part of the joint covariance of the parent clique, as the
+ * separator is contained in the variables of the parent.
+ */
+class GTSAM_EXPORT CliqueCovariance {
+ public:
+  typedef boost::shared_ptr<const CliqueCovariance> shared_ptr;
+
+  /// Compute from a conditional, and the covariance of the parent clique, or
+  /// null for a root
+  CliqueCovariance(const GaussianConditional& conditional,
+                   const CliqueCovariance* parent);
+
+  /// The frontal and separator variables
+  const KeyVector& keys() const { return keys_; }
+
+  /// The joint covariance of keys()
+  const Matrix& covariance() const { return covariance_; }
+
+  /// Whether the clique contains \c key
+  bool contains(Key key) const;
+
+  /// The block of the covariance of \c i and \c j, which have to be in keys()
+  Matrix block(Key i, Key j) const;
+
+ private:
+  /// Index of \c key in keys_, throws std::out_of_range if not found
+  size_t index(Key key) const;
+
+  KeyVector keys_;
+  std::vector<DenseIndex> offsets_;  ///< Start of every key, and the end
+  Matrix covariance_;
+};
+
+/**
+ * Blocks of the covariance (R^T R)^{-1} of a GaussianBayesTree, computed
+ * without forming the inverse: the joint covariance of every clique is
+ * computed top-down from the joint covariance of its parent, see
+ * CliqueCovariance.  This recovers, in one pass, the marginal covariance of
+ * every variable and the cross-covariances of the variables that share a
+ * clique, in parallel across subtrees when GTSAM is built with TBB or the
+ * thread pool.  When only some variables are requested, only their cliques
+ * and the ancestors of those are visited.
+ */
+class GTSAM_EXPORT SparseInverse {
+ public:
+  /// Recover the covariance blocks of all variables
+  explicit SparseInverse(const GaussianBayesTree& bayesTree);
+
+  /// Recover the covariance blocks of the cliques of \c variables
+  SparseInverse(const GaussianBayesTree& bayesTree, const KeyVector& variables);
+
+  /// Whether the covariance of \c variable was recovered
+  bool exists(Key variable) const { return cliques_.exists(variable); }
+
+  /// The marginal covariance of \c variable
+  Matrix marginalCovariance(Key variable) const;
+
+  /**
+   * The cross-covariance of \c i and \c j.  Only available if one of them is
+   * a frontal variable of a clique that contains the other, otherwise throws
+   * std::invalid_argument; use Marginals::jointMarginalCovariance instead.
+   */
+  Matrix jointCovariance(Key i, Key j) const;
+
+  /// The joint covariance of the clique in which \c variable is frontal
+  const CliqueCovariance& clique(Key variable) const;
+
+ private:
+  void compute(const GaussianBayesTree& bayesTree,
+               const KeyVector* variables);
+
+  /// Covariance of every recovered clique, by frontal variable
+  FastMap<Key, CliqueCovariance::shared_ptr> cliques_;
+};
+
+}  // namespace gtsam
@@ -17,6 +17,7 @@
 
 #include <gtsam/base/DSFVector.h>
 #include <gtsam/base/FastMap.h>
+#include <gtsam/base/ThreadPool.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/inference/VariableIndex.h>
 #include <gtsam/linear/Errors.h>
@@ -29,10 +30,12 @@
 #include <boost/serialization/vector.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <numeric>  // accumulate
 #include <queue>
 #include <set>
@@ -223,6 +226,8 @@ SubgraphBuilderParameters::skeletonTranslator(const std::string &src) {
     return BFS;
   else if (s == "KRUSKAL")
     return KRUSKAL;
+  else if (s == "BORUVKA")
+    return BORUVKA;
   throw std::invalid_argument(
       "SubgraphBuilderParameters::skeletonTranslator undefined string " + s);
   return KRUSKAL;
@@ -236,6 +241,8 @@ std::string SubgraphBuilderParameters::skeletonTranslator(Skeleton s) {
     return "BFS";
   else if (s == KRUSKAL)
     return "KRUSKAL";
+  else if (s == BORUVKA)
+    return "BORUVKA";
   else
     return "UNKNOWN";
 }
@@ -315,6 +322,9 @@ vector<size_t> SubgraphBuilder::buildTree(const GaussianFactorGraph &gfg,
     case SubgraphBuilderParameters::KRUSKAL:
       return kruskal(gfg, ordering, weights);
       break;
+    case SubgraphBuilderParameters::BORUVKA:
+      return boruvka(gfg, ordering, weights);
+      break;
     default:
       std::cerr << "SubgraphBuilder::buildTree undefined skeleton type" << endl;
       break;
@@ -420,6 +430,82 @@ vector<size_t> SubgraphBuilder::kruskal(const GaussianFactorGraph &gfg,
   return treeIndices;
 }
 
+/****************************************************************/
+vector<size_t> SubgraphBuilder::boruvka(const GaussianFactorGraph &gfg,
+                                        const FastMap<Key, size_t> &ordering,
+                                        const vector<double> &weights) const {
+  const size_t n = ordering.size();
+  static const size_t none = std::numeric_limits<size_t>::max();
+
+  // The binary factors are the edges of the graph
+  vector<size_t> edges;
+  for (size_t index = 0; index < gfg.size(); ++index)
+    if (gfg[index] && gfg[index]->keys().size() == 2) edges.push_back(index);
+
+  // Sort the edges by weight, ties broken by index, such that an edge is
+  // lighter than another if it comes first.  This makes the minimum spanning
+  // tree unique, and prevents the lightest edges of the components from
+  // forming a cycle.
+  std::stable_sort(edges.begin(), edges.end(), [&](size_t a, size_t b) {
+    return weights[a] < weights[b];
+  });
+  vector<std::pair<size_t, size_t> > ends;
+  ends.reserve(edges.size());
+  for (const size_t index : edges) {
+    const auto &keys = gfg[index]->keys();
+    ends.emplace_back(ordering.at(keys[0]), ordering.at(keys[1]));
+  }
+
+  vector<size_t> treeIndices;
+  treeIndices.reserve(n > 0 ? n - 1 : 0);
+  DSFVector dsf(n);
+  vector<size_t> component(n);
+  vector<std::atomic<size_t> > lightest(n);
+  for (;;) {
+    for (size_t v = 0; v < n; ++v) {
+      component[v] = dsf.find(v);
+      lightest[v].store(none, std::memory_order_relaxed);
+    }
+
+    // Find the lightest edge leaving every component, by an atomic minimum
+    // over the position of the edges, such that all threads share one array
+    auto search = [&](size_t begin, size_t end) {
+      for (size_t e = begin; e < end; ++e) {
+        const size_t cu = component[ends[e].first],
+                     cv = component[ends[e].second];
+        if (cu == cv) continue;
+        for (const size_t c : {cu, cv}) {
+          size_t current = lightest[c].load(std::memory_order_relaxed);
+          while (e < current &&
+                 !lightest[c].compare_exchange_weak(current, e,
+                                                    std::memory_order_relaxed))
+            ;
+        }
+      }
+    };
+#ifdef GTSAM_USE_THREAD_POOL
+    ThreadPool::Global().parallelFor(0, edges.size(), search, 1024);
+#else
+    search(0, edges.size());
+#endif
+
+    // Add them to the tree, two components may have picked the same edge
+    bool merged = false;
+    for (size_t c = 0; c < n; ++c) {
+      const size_t e = lightest[c].load(std::memory_order_relaxed);
+      if (e == none) continue;
+      const size_t u = ends[e].first, v = ends[e].second;
+      if (dsf.find(u) != dsf.find(v)) {
+        dsf.merge(u, v);
+        treeIndices.push_back(edges[e]);
+        merged = true;
+      }
+    }
+    if (!merged) break;
+  }
+  return treeIndices;
+}
+
 /****************************************************************/
 vector<size_t> SubgraphBuilder::sample(const vector<double> &weights,
                                        const size_t t) const {
@@ -466,6 +552,84 @@ Subgraph SubgraphBuilder::operator()(
   return Subgraph(subgraph);
 }
 
+/****************************************************************/
+Subgraph SubgraphBuilder::update(const GaussianFactorGraph &gfg,
+                                 const Subgraph &subgraph,
+                                 size_t numOldFactors) const {
+  const auto &p = parameters_;
+  const size_t m = gfg.size();
+  if (numOldFactors > m)
+    throw std::invalid_argument(
+        "SubgraphBuilder::update: more old factors than in the graph");
+  const FastMap<Key, size_t> ordering = Ordering::Natural(gfg).invert();
+  const size_t n = ordering.size();
+
+  auto endPoints = [&](size_t index) {
+    const auto &keys = gfg[index]->keys();
+    return std::make_pair(ordering.at(keys[0]), ordering.at(keys[1]));
+  };
+
+  // Recover the spanning tree of the old subgraph, the other binary edges
+  // were sampled
+  DSFVector dsf(n);
+  size_t numExtraEdges = 0;
+  for (const Subgraph::Edge &edge : subgraph) {
+    if (edge.index >= numOldFactors)
+      throw std::invalid_argument(
+          "SubgraphBuilder::update: subgraph contains new factors");
+    if (!gfg[edge.index] || gfg[edge.index]->size() != 2) continue;
+    const auto uv = endPoints(edge.index);
+    if (dsf.find(uv.first) != dsf.find(uv.second))
+      dsf.merge(uv.first, uv.second);
+    else
+      ++numExtraEdges;
+  }
+
+  // Add the new unary factors, and extend the tree with the lightest new
+  // edges, as in kruskal
+  vector<double> weights = this->weights(gfg);
+  Subgraph::Edges edges = subgraph.edges();
+  vector<size_t> candidates;
+  for (size_t index = numOldFactors; index < m; ++index) {
+    if (!gfg[index]) continue;
+    if (gfg[index]->size() == 1)
+      edges.push_back(Subgraph::Edge{index, 1.0});
+    else if (gfg[index]->size() == 2)
+      candidates.push_back(index);
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [&](size_t a, size_t b) { return weights[a] < weights[b]; });
+  vector<double> offTreeWeights(m, 0.0);
+  size_t numOffTree = 0;
+  for (const size_t index : candidates) {
+    const auto uv = endPoints(index);
+    if (dsf.find(uv.first) != dsf.find(uv.second)) {
+      dsf.merge(uv.first, uv.second);
+      edges.push_back(Subgraph::Edge{index, 1.0});
+    } else if (weights[index] > 0.0) {
+      offTreeWeights[index] = weights[index];
+      ++numOffTree;
+    }
+  }
+  for (size_t v = 1; v < n; ++v) {
+    if (dsf.find(v) != dsf.find(0))
+      throw std::runtime_error(
+          "SubgraphBuilder::update failure: subgraph is not spanning");
+  }
+
+  // Sample new extra edges, with the same budget as operator()
+  const size_t numRemaining = m - (n - 1);
+  const size_t budget =
+      std::min<size_t>(n * p.augmentationFactor, numRemaining / 2);
+  const size_t numSamples =
+      budget > numExtraEdges ? std::min(budget - numExtraEdges, numOffTree) : 0;
+  if (numSamples > 0) {
+    for (const size_t index : sample(offTreeWeights, numSamples))
+      edges.push_back(Subgraph::Edge{index, 1.0});
+  }
+  return Subgraph(edges);
+}
+
 /****************************************************************/
 SubgraphBuilder::Weights SubgraphBuilder::weights(
     const GaussianFactorGraph &gfg) const {
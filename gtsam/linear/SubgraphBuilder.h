@@ -100,6 +100,7 @@ struct GTSAM_EXPORT SubgraphBuilderParameters {
     NATURALCHAIN = 0, /* natural ordering of the graph */
     BFS,              /* breadth-first search tree */
     KRUSKAL,          /* maximum weighted spanning tree */
+    BORUVKA,          /* minimum spanning tree, searched in parallel */
   } skeletonType;
 
   enum SkeletonWeight {            /* how to weigh the graph edges */
@@ -154,6 +155,17 @@ class GTSAM_EXPORT SubgraphBuilder {
   virtual ~SubgraphBuilder() {}
   virtual Subgraph operator()(const GaussianFactorGraph &jfg) const;
 
+  /**
+   * Extend a subgraph of the first \c numOldFactors factors of \c gfg to the
+   * factors appended after them, e.g., in an online loop, without building a
+   * new spanning tree: the new unary factors are added, new binary factors
+   * that connect new variables extend the tree in order of their weights, and
+   * the remaining ones are sampled as extra edges, within the budget of the
+   * augmentation factor.
+   */
+  Subgraph update(const GaussianFactorGraph &gfg, const Subgraph &subgraph,
+                  size_t numOldFactors) const;
+
  private:
   std::vector<size_t> buildTree(const GaussianFactorGraph &gfg,
                                 const FastMap<Key, size_t> &ordering,
@@ -164,6 +176,9 @@ class GTSAM_EXPORT SubgraphBuilder {
   std::vector<size_t> kruskal(const GaussianFactorGraph &gfg,
                               const FastMap<Key, size_t> &ordering,
                               const std::vector<double> &weights) const;
+  std::vector<size_t> boruvka(const GaussianFactorGraph &gfg,
+                              const FastMap<Key, size_t> &ordering,
+                              const std::vector<double> &weights) const;
   std::vector<size_t> sample(const std::vector<double> &weights,
                              const size_t t) const;
   Weights weights(const GaussianFactorGraph &gfg) const;
@@ -45,6 +45,20 @@ SubgraphSolver::SubgraphSolver(const GaussianFactorGraph &Ab,
   pc_ = boost::make_shared<SubgraphPreconditioner>(Ab2, Rc1, xbar);
 }
 
+/**************************************************************************************************/
+// Taking system [A|b] and the subgraph to split it with
+SubgraphSolver::SubgraphSolver(const GaussianFactorGraph &Ab,
+                               const Subgraph &subgraph,
+                               const Parameters &parameters,
+                               const Ordering &ordering)
+    : parameters_(parameters) {
+  GaussianFactorGraph::shared_ptr Ab1, Ab2;
+  std::tie(Ab1, Ab2) = splitFactorGraph(Ab, subgraph);
+  auto Rc1 = Ab1->eliminateSequential(ordering, EliminateQR);
+  auto xbar = boost::make_shared<VectorValues>(Rc1->optimize());
+  pc_ = boost::make_shared<SubgraphPreconditioner>(Ab2, Rc1, xbar);
+}
+
 /**************************************************************************************************/
 // Taking eliminated tree [R1|c] and constraint graph [A2|b2]
 SubgraphSolver::SubgraphSolver(const GaussianBayesNet::shared_ptr &Rc1,
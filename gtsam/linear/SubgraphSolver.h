@@ -93,6 +93,14 @@ class GTSAM_EXPORT SubgraphSolver : public IterativeSolver {
   SubgraphSolver(const GaussianFactorGraph &A, const Parameters &parameters,
                  const Ordering &ordering);
 
+  /**
+   * Split the graph according to a given subgraph, e.g., one kept up to date
+   * with SubgraphBuilder::update as factors are appended, instead of building
+   * a new spanning tree.
+   */
+  SubgraphSolver(const GaussianFactorGraph &A, const Subgraph &subgraph,
+                 const Parameters &parameters, const Ordering &ordering);
+
   /**
    * The user specifies the subgraph part and the constraints part.
    * May throw exception if A1 is underdetermined. An ordering is required to
@@ -0,0 +1,445 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SupernodalCholesky.cpp
+ * @brief   Supernodal sparse Cholesky factorization of a GaussianFactorGraph
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SupernodalCholesky.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/symbolic/SymbolicFactorGraph.h>
+#include <gtsam/symbolic/SymbolicBayesTree.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/timing.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+static const size_t kUnused = numeric_limits<size_t>::max();
+
+namespace {
+/// Where a variable lives: its supernode, and its offset in the frontals
+struct Owner {
+  size_t supernode;
+  size_t frontalOffset;
+  size_t solutionIndex;
+};
+}  // namespace
+
+/* ************************************************************************* */
+SupernodalCholesky::SupernodalCholesky(const GaussianFactorGraph& graph,
+                                       const Ordering& ordering)
+    : storageSize_(0), maxSeparatorDim_(0) {
+  gttic(SupernodalCholesky_analyze);
+  const map<Key, size_t> keyDims = graph.getKeyDimMap();
+  auto dim = [&](Key key) {
+    map<Key, size_t>::const_iterator it = keyDims.find(key);
+    if (it == keyDims.end())
+      throw invalid_argument("SupernodalCholesky: variable " +
+                             DefaultKeyFormatter(key) +
+                             " in the ordering is not in the graph");
+    return it->second;
+  };
+
+  // Symbolic elimination, the cliques are the supernodes
+  SymbolicFactorGraph symbolic;
+  for (const GaussianFactor::shared_ptr& factor : graph)
+    if (factor) symbolic.push_back(SymbolicFactor::FromKeysShared(factor->keys()));
+  const SymbolicBayesTree::shared_ptr bayesTree =
+      symbolic.eliminateMultifrontal(ordering);
+
+  // Visit the cliques in post-order, children before their parent.  The
+  // order of the first frontals is not enough: merging cliques in the
+  // elimination tree can put a parent's first frontal before its children's.
+  vector<const SymbolicConditional*> conditionals;
+  conditionals.reserve(bayesTree->size());
+  {
+    typedef pair<SymbolicBayesTree::sharedClique, bool> Visit;
+    vector<Visit> stack;
+    for (auto it = bayesTree->roots().rbegin(); it != bayesTree->roots().rend();
+         ++it)
+      stack.push_back(Visit(*it, false));
+    while (!stack.empty()) {
+      Visit visit = stack.back();
+      stack.pop_back();
+      if (visit.second) {
+        conditionals.push_back(visit.first->conditional().get());
+        continue;
+      }
+      stack.push_back(Visit(visit.first, true));
+      for (auto it = visit.first->children.rbegin();
+           it != visit.first->children.rend(); ++it)
+        stack.push_back(Visit(*it, false));
+    }
+  }
+
+  // Create the supernodes, and lay out the solution in the same order
+  FastMap<Key, Owner> owners;
+  size_t solutionSize = 0;
+  for (const SymbolicConditional* conditional : conditionals) {
+    Supernode supernode;
+    supernode.frontals.assign(conditional->beginFrontals(),
+                              conditional->endFrontals());
+    supernode.separator.assign(conditional->beginParents(),
+                               conditional->endParents());
+    supernode.solutionOffset = solutionSize;
+    supernode.frontalDim = 0;
+    for (Key frontal : supernode.frontals) {
+      owners[frontal] = Owner{supernodes_.size(), supernode.frontalDim,
+                              solutionSize + supernode.frontalDim};
+      keys_.push_back(frontal);
+      dims_.push_back(dim(frontal));
+      supernode.frontalDim += dims_.back();
+    }
+    supernode.separatorDim = 0;
+    for (Key parent : supernode.separator) supernode.separatorDim += dim(parent);
+    supernode.offset = storageSize_;
+    storageSize_ += supernode.frontalDim *
+                    (supernode.frontalDim + supernode.separatorDim);
+    solutionSize += supernode.frontalDim;
+    maxSeparatorDim_ = std::max(maxSeparatorDim_, supernode.separatorDim);
+    supernodes_.push_back(std::move(supernode));
+  }
+
+  // The upper triangle is defined by the solution order, and the separators
+  // are sorted in that order, as ancestors come after their descendants
+  FastMap<Key, size_t> position;
+  for (size_t i = 0; i < keys_.size(); ++i) position[keys_[i]] = i;
+  for (Supernode& supernode : supernodes_)
+    sort(supernode.separator.begin(), supernode.separator.end(),
+         [&](Key a, Key b) { return position.at(a) < position.at(b); });
+
+  // Column of each key in the panel of each supernode
+  vector<FastMap<Key, size_t> > columns(supernodes_.size());
+  for (size_t s = 0; s < supernodes_.size(); ++s) {
+    const Supernode& supernode = supernodes_[s];
+    for (Key frontal : supernode.frontals)
+      columns[s][frontal] = owners.at(frontal).frontalOffset;
+    size_t column = supernode.frontalDim;
+    for (Key parent : supernode.separator) {
+      columns[s][parent] = column;
+      column += dim(parent);
+    }
+  }
+  auto columnOf = [&](size_t s, Key key) {
+    FastMap<Key, size_t>::const_iterator it = columns[s].find(key);
+    if (it == columns[s].end())
+      throw std::logic_error(
+          "SupernodalCholesky: inconsistent symbolic factorization");
+    return it->second;
+  };
+
+  // Targets of the Schur complement of each supernode.  Along the path to
+  // the root, the separator variables owned by the same ancestor are
+  // consecutive in solution order.
+  for (Supernode& supernode : supernodes_) {
+    const KeyVector& separator = supernode.separator;
+    vector<size_t> starts(separator.size() + 1, 0);
+    for (size_t k = 0; k < separator.size(); ++k) {
+      starts[k + 1] = starts[k] + dim(separator[k]);
+      const Owner& owner = owners.at(separator[k]);
+      for (size_t e = 0; e < dim(separator[k]); ++e)
+        supernode.separatorIndices.push_back(owner.solutionIndex + e);
+    }
+
+    for (size_t k = 0; k < separator.size();) {
+      Supernode::Update update;
+      update.target = owners.at(separator[k]).supernode;
+      size_t kEnd = k;
+      while (kEnd < separator.size() &&
+             owners.at(separator[kEnd]).supernode == update.target)
+        ++kEnd;
+      update.begin = starts[k];
+      update.end = starts[kEnd];
+      for (size_t i = k; i < kEnd; ++i)
+        for (size_t e = 0; e < dim(separator[i]); ++e)
+          update.rows.push_back(owners.at(separator[i]).frontalOffset + e);
+      for (size_t i = k; i < separator.size(); ++i) {
+        const size_t column = columnOf(update.target, separator[i]);
+        for (size_t e = 0; e < dim(separator[i]); ++e)
+          update.cols.push_back(column + e);
+      }
+      supernode.updates.push_back(std::move(update));
+      k = kEnd;
+    }
+  }
+
+  // Targets of the information matrix and vector of each factor
+  assembly_.resize(graph.size());
+  for (size_t f = 0; f < graph.size(); ++f) {
+    if (!graph[f]) continue;
+    Assembly& assembly = assembly_[f];
+    assembly.keys = graph[f]->keys();
+    const size_t n = assembly.keys.size();
+    assembly.blocks.assign(n * n, Target{kUnused, 0});
+    for (size_t i = 0; i < n; ++i) {
+      const Key row = assembly.keys[i];
+      const Owner& owner = owners.at(row);
+      const Supernode& supernode = supernodes_[owner.supernode];
+      assembly.rhs.push_back(owner.solutionIndex);
+      for (size_t j = 0; j < n; ++j) {
+        const Key col = assembly.keys[j];
+        if (position.at(row) > position.at(col)) continue;
+        assembly.blocks[i * n + j] = Target{
+            supernode.offset +
+                columnOf(owner.supernode, col) * supernode.frontalDim +
+                owner.frontalOffset,
+            supernode.frontalDim};
+      }
+    }
+  }
+}
+
+/* ************************************************************************* */
+bool SupernodalCholesky::hasSameStructure(
+    const GaussianFactorGraph& graph) const {
+  if (graph.size() != assembly_.size()) return false;
+  for (size_t f = 0; f < graph.size(); ++f) {
+    if (graph[f] ? graph[f]->keys() != assembly_[f].keys
+                 : !assembly_[f].keys.empty())
+      return false;
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+void SupernodalCholesky::factorize(const GaussianFactorGraph& graph) {
+  gttic(SupernodalCholesky_factorize);
+  assembleInto(graph, storage_);
+  factorizeInPlace();
+}
+
+/* ************************************************************************* */
+void SupernodalCholesky::assemble(const GaussianFactorGraph& graph) {
+  gttic(SupernodalCholesky_assemble);
+  assembleInto(graph, hessian_);
+}
+
+/* ************************************************************************* */
+void SupernodalCholesky::factorizeDamped(double lambda,
+                                         const VectorValues* diagonal) {
+  gttic(SupernodalCholesky_factorizeDamped);
+  if (size_t(hessian_.size()) != storageSize_)
+    throw invalid_argument(
+        "SupernodalCholesky::factorizeDamped: assemble() was not called");
+
+  // Start from the undamped system, the copy reuses the existing storage
+  storage_ = hessian_;
+  size_t i = 0;  // Index in keys_, which lists the frontals in order
+  for (const Supernode& supernode : supernodes_) {
+    double* data = storage_.data() + supernode.offset;
+    const size_t fd = supernode.frontalDim;
+    size_t l = 0;
+    for (Key key : supernode.frontals) {
+      const size_t d = dims_[i++];
+      if (!diagonal) {
+        for (size_t e = 0; e < d; ++e, ++l) data[l * (fd + 1)] += lambda;
+        continue;
+      }
+      VectorValues::const_iterator it = diagonal->find(key);
+      if (it == diagonal->end()) {
+        l += d;  // No damping for variables without a diagonal
+        continue;
+      }
+      for (size_t e = 0; e < d; ++e, ++l)
+        data[l * (fd + 1)] += lambda * it->second(e);
+    }
+  }
+  factorizeInPlace();
+}
+
+/* ************************************************************************* */
+void SupernodalCholesky::assembleInto(const GaussianFactorGraph& graph,
+                                      Vector& storage) {
+  if (!hasSameStructure(graph))
+    throw invalid_argument(
+        "SupernodalCholesky::factorize: graph structure differs from the "
+        "analyzed one");
+
+  // Assemble the upper triangle of the information matrix, and the vector
+  gttic(assemble);
+  storage.setZero(storageSize_);
+  rhs_.setZero(keys_.empty() ? 0 : supernodes_.back().solutionOffset +
+                                       supernodes_.back().frontalDim);
+  typedef Eigen::Map<Matrix, 0, Eigen::OuterStride<> > TargetBlock;
+  boost::optional<JacobianFactor> whitened;
+  for (size_t f = 0; f < graph.size(); ++f) {
+    const GaussianFactor::shared_ptr& factor = graph[f];
+    if (!factor) continue;
+    const Assembly& assembly = assembly_[f];
+    const size_t n = assembly.keys.size();
+
+    // Jacobian factors: accumulate A'A and A'b straight from the blocks
+    if (const JacobianFactor* jacobian =
+            dynamic_cast<const JacobianFactor*>(factor.get())) {
+      const SharedDiagonal& model = jacobian->get_model();
+      if (model && !model->isUnit()) {
+        if (model->isConstrained())
+          throw invalid_argument(
+              "SupernodalCholesky: constrained noise models are not supported");
+        whitened = jacobian->whiten();
+        jacobian = whitened.get_ptr();
+      }
+      const auto b = jacobian->getb();
+      for (size_t i = 0; i < n; ++i) {
+        const auto Ai = jacobian->getA(jacobian->begin() + i);
+        rhs_.segment(assembly.rhs[i], Ai.cols()).noalias() += Ai.transpose() * b;
+        for (size_t j = 0; j < n; ++j) {
+          const Target& target = assembly.blocks[i * n + j];
+          if (target.offset == kUnused) continue;
+          const auto Aj = jacobian->getA(jacobian->begin() + j);
+          TargetBlock block(storage.data() + target.offset, Ai.cols(),
+                            Aj.cols(), Eigen::OuterStride<>(target.stride));
+          block.noalias() += Ai.transpose() * Aj;
+        }
+      }
+      continue;
+    }
+
+    // Hessian factors: copy the stored upper triangle
+    if (const HessianFactor* hessian =
+            dynamic_cast<const HessianFactor*>(factor.get())) {
+      const SymmetricBlockMatrix& info = hessian->info();
+      for (size_t i = 0; i < n; ++i) {
+        const auto g = hessian->linearTerm(hessian->begin() + i);
+        rhs_.segment(assembly.rhs[i], g.rows()) += g;
+        for (size_t j = 0; j < n; ++j) {
+          const Target& target = assembly.blocks[i * n + j];
+          if (target.offset == kUnused) continue;
+          TargetBlock block(storage.data() + target.offset, info.getDim(i),
+                            info.getDim(j), Eigen::OuterStride<>(target.stride));
+          if (i == j)
+            block.triangularView<Eigen::Upper>() +=
+                info.diagonalBlock(i).nestedExpression();
+          else if (i < j)
+            block += info.aboveDiagonalBlock(i, j);
+          else
+            block += info.aboveDiagonalBlock(j, i).transpose();
+        }
+      }
+      continue;
+    }
+
+    // Any other factor, through its dense augmented information matrix
+    const Matrix information = factor->augmentedInformation();
+    const DenseIndex last = information.cols() - 1;
+    DenseIndex rowStart = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const DenseIndex rows = factor->getDim(factor->begin() + i);
+      rhs_.segment(assembly.rhs[i], rows) +=
+          information.block(rowStart, last, rows, 1);
+      DenseIndex colStart = 0;
+      for (size_t j = 0; j < n; ++j) {
+        const DenseIndex cols = factor->getDim(factor->begin() + j);
+        const Target& target = assembly.blocks[i * n + j];
+        if (target.offset != kUnused) {
+          TargetBlock block(storage.data() + target.offset, rows, cols,
+                            Eigen::OuterStride<>(target.stride));
+          block += information.block(rowStart, colStart, rows, cols);
+        }
+        colStart += cols;
+      }
+      rowStart += rows;
+    }
+  }
+  gttoc(assemble);
+}
+
+/* ************************************************************************* */
+void SupernodalCholesky::factorizeInPlace() {
+  // Factor the supernodes from the leaves up
+  gttic(factor);
+  workspace_.resize(maxSeparatorDim_, maxSeparatorDim_);
+  for (const Supernode& supernode : supernodes_) {
+    const DenseIndex fd = supernode.frontalDim, sd = supernode.separatorDim;
+    Eigen::Map<Matrix> panel(storage_.data() + supernode.offset, fd, fd + sd);
+
+    // R11 = chol(H11)
+    Eigen::Ref<Matrix> R11 = panel.leftCols(fd);
+    Eigen::LLT<Eigen::Ref<Matrix>, Eigen::Upper> llt(R11);
+    if (llt.info() != Eigen::Success)
+      throw IndeterminantLinearSystemException(supernode.frontals.front());
+    if (sd == 0) continue;
+
+    // R12 = R11' \ H12
+    auto R12 = panel.rightCols(sd);
+    R11.triangularView<Eigen::Upper>().transpose().solveInPlace(R12);
+
+    // Schur complement R12' * R12, subtracted from the ancestors
+    Eigen::Map<Matrix> schur(workspace_.data(), sd, sd);
+    schur.triangularView<Eigen::Upper>().setZero();
+    schur.selfadjointView<Eigen::Upper>().rankUpdate(R12.transpose());
+    for (const Supernode::Update& update : supernode.updates) {
+      const Supernode& target = supernodes_[update.target];
+      double* data = storage_.data() + target.offset;
+      const size_t stride = target.frontalDim;
+      for (size_t c = update.begin; c < size_t(sd); ++c) {
+        double* column = data + update.cols[c - update.begin] * stride;
+        const size_t rowEnd = std::min(c + 1, update.end);
+        for (size_t r = update.begin; r < rowEnd; ++r)
+          column[update.rows[r - update.begin]] -= schur(r, c);
+      }
+    }
+  }
+}
+
+/* ************************************************************************* */
+VectorValues SupernodalCholesky::solve() const {
+  gttic(SupernodalCholesky_solve);
+  Vector x = rhs_;
+
+  // Forward substitution R' y = eta
+  for (const Supernode& supernode : supernodes_) {
+    const DenseIndex fd = supernode.frontalDim, sd = supernode.separatorDim;
+    Eigen::Map<const Matrix> panel(storage_.data() + supernode.offset, fd,
+                                   fd + sd);
+    auto xf = x.segment(supernode.solutionOffset, fd);
+    panel.leftCols(fd).transpose().triangularView<Eigen::Lower>().solveInPlace(
+        xf);
+    if (sd == 0) continue;
+    const Vector t = panel.rightCols(sd).transpose() * xf;
+    for (DenseIndex k = 0; k < sd; ++k) x(supernode.separatorIndices[k]) -= t(k);
+  }
+
+  // Back substitution R x = y
+  for (auto it = supernodes_.rbegin(); it != supernodes_.rend(); ++it) {
+    const Supernode& supernode = *it;
+    const DenseIndex fd = supernode.frontalDim, sd = supernode.separatorDim;
+    Eigen::Map<const Matrix> panel(storage_.data() + supernode.offset, fd,
+                                   fd + sd);
+    auto xf = x.segment(supernode.solutionOffset, fd);
+    if (sd > 0) {
+      Vector xs(sd);
+      for (DenseIndex k = 0; k < sd; ++k) xs(k) = x(supernode.separatorIndices[k]);
+      xf.noalias() -= panel.rightCols(sd) * xs;
+    }
+    panel.leftCols(fd).triangularView<Eigen::Upper>().solveInPlace(xf);
+  }
+
+  VectorValues result;
+  DenseIndex offset = 0;
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    result.insert(keys_[i], x.segment(offset, dims_[i]));
+    offset += dims_[i];
+  }
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SupernodalCholesky.h
+ * @brief   Supernodal sparse Cholesky factorization of a GaussianFactorGraph
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/inference/Ordering.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Solves the normal equations of a GaussianFactorGraph with a supernodal
+ * sparse Cholesky factorization H = R'R.
+ *
+ * The constructor does the symbolic analysis: it eliminates the graph
+ * symbolically in the given ordering, and the cliques of the resulting
+ * SymbolicBayesTree become the supernodes.  The upper-triangular factor R of
+ * all supernodes is stored in a single preallocated array, one dense panel
+ * [R11 R12] per supernode, and the analysis precomputes where every factor's
+ * Hessian blocks and every supernode's Schur complement land in that array.
+ *
+ * factorize() then only assembles the Hessian of the factors in place and
+ * factors the supernodes from the leaves up, with one dense Cholesky, one
+ * triangular solve and one symmetric rank update per supernode, without any
+ * per-clique allocation.  Since the analysis only depends on the sparsity
+ * structure, the same object can factorize any number of graphs with the same
+ * structure, e.g. successive linearizations in a nonlinear optimizer.
+ *
+ * Factors with constrained noise models are not supported.
+ */
+class GTSAM_EXPORT SupernodalCholesky {
+ public:
+  /// A supernode: a clique of frontal variables sharing the same separator
+  struct Supernode {
+    KeyVector frontals;          ///< Frontal keys, as in the clique
+    KeyVector separator;         ///< Separator keys, in solution order
+    size_t frontalDim;           ///< Total dimension of the frontal keys
+    size_t separatorDim;         ///< Total dimension of the separator keys
+    size_t offset;               ///< Start of the panel [R11 R12] in storage
+    size_t solutionOffset;       ///< Start of the frontals in the solution
+    std::vector<size_t> separatorIndices;  ///< Separator scalars in the solution
+
+    /// Where part of the Schur complement is subtracted in an ancestor panel
+    struct Update {
+      size_t target;              ///< The ancestor supernode
+      size_t begin, end;          ///< Separator scalars that are its frontals
+      std::vector<size_t> rows;   ///< Panel row of separator scalars [begin,end)
+      std::vector<size_t> cols;   ///< Panel column of scalars [begin,separatorDim)
+    };
+    std::vector<Update> updates;
+  };
+
+ private:
+  /// Where a block of a factor's information matrix goes in storage
+  struct Target {
+    size_t offset;  ///< Position of the top-left entry
+    size_t stride;  ///< Distance between columns
+  };
+
+  /// How to assemble one factor
+  struct Assembly {
+    KeyVector keys;                ///< Keys of the factor, to check structure
+    std::vector<Target> blocks;    ///< Block (i,j) of the factor at i*n+j
+    std::vector<size_t> rhs;       ///< Position of each key in the solution
+  };
+
+  std::vector<Supernode> supernodes_;  ///< Children before parents
+  std::vector<Assembly> assembly_;     ///< One per factor in the graph
+  KeyVector keys_;                     ///< All keys, in solution order
+  std::vector<size_t> dims_;           ///< Dimension of each key in keys_
+  size_t storageSize_;                 ///< Number of doubles in the factor R
+  size_t maxSeparatorDim_;             ///< Size of the Schur workspace
+
+  Vector storage_;    ///< The panels of all supernodes
+  Vector rhs_;        ///< Information vector, in solution order
+  Matrix workspace_;  ///< Schur complement of the current supernode
+  Vector hessian_;    ///< Undamped assembled system, see assemble()
+
+  /// Assemble the upper triangle of the information matrix into \c storage
+  void assembleInto(const GaussianFactorGraph& graph, Vector& storage);
+
+  /// Factorize the system assembled in storage_
+  void factorizeInPlace();
+
+ public:
+  /// Symbolic analysis of the normal equations of \c graph in \c ordering
+  SupernodalCholesky(const GaussianFactorGraph& graph, const Ordering& ordering);
+
+  /**
+   * Assemble and factorize the normal equations of \c graph, which must have
+   * the same factors and keys as the graph given to the constructor.
+   * @throws IndeterminantLinearSystemException if the system is not positive
+   * definite, and std::invalid_argument if the structure differs.
+   */
+  void factorize(const GaussianFactorGraph& graph);
+
+  /**
+   * Assemble the normal equations of \c graph and keep them, undamped, for
+   * repeated calls to factorizeDamped().
+   * @throws std::invalid_argument if the structure differs.
+   */
+  void assemble(const GaussianFactorGraph& graph);
+
+  /**
+   * Factorize the system of the last assemble() with \c lambda times the
+   * given diagonal added to the diagonal of the Hessian, or \c lambda times
+   * the identity if no diagonal is given.  Variables missing from the
+   * diagonal are not damped.  This is the Levenberg-Marquardt damped system,
+   * without the graph copy and prior factors of the factor graph version.
+   * @throws IndeterminantLinearSystemException if the damped system is not
+   * positive definite.
+   */
+  void factorizeDamped(double lambda, const VectorValues* diagonal = nullptr);
+
+  /// Solve the factorized normal equations, must be called after factorize()
+  VectorValues solve() const;
+
+  /// Factorize \c graph and solve its normal equations
+  VectorValues optimize(const GaussianFactorGraph& graph) {
+    factorize(graph);
+    return solve();
+  }
+
+  /// Check whether \c graph has the structure this object was created for
+  bool hasSameStructure(const GaussianFactorGraph& graph) const;
+
+  /// The supernodes, in post-order: children before their parents
+  const std::vector<Supernode>& supernodes() const { return supernodes_; }
+
+  /// Number of doubles used to store the factor R
+  size_t storageSize() const { return storageSize_; }
+};
+
+}  // namespace gtsam
@@ -22,6 +22,10 @@
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 
+#ifdef GTSAM_USE_THREAD_POOL
+#include <mutex>
+#endif
+
 namespace gtsam
 {
   namespace internal
@@ -47,6 +51,9 @@ namespace gtsam
       struct OptimizeClique
       {
         VectorValues collectedResult;
+#ifdef GTSAM_USE_THREAD_POOL
+        std::mutex collectedResultMutex; // Without TBB, VectorValues is not safe for concurrent insertion
+#endif
 
         OptimizeData operator()(
           const boost::shared_ptr<CLIQUE>& clique,
@@ -96,6 +103,9 @@ namespace gtsam
             if(solution.hasNaN()) throw IndeterminantLinearSystemException(c.keys().front());
 
             // Insert solution into a VectorValues
+#ifdef GTSAM_USE_THREAD_POOL
+            std::lock_guard<std::mutex> lock(collectedResultMutex);
+#endif
             DenseIndex vectorPosition = 0;
             for(GaussianConditional::const_iterator frontal = c.beginFrontals(); frontal != c.endFrontals(); ++frontal) {
               VectorValues::const_iterator r =
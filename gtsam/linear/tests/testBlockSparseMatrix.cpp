@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testBlockSparseMatrix.cpp
+ * @brief   Unit tests for BlockSparseMatrix
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/BlockSparseMatrix.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// A chain 0-1-2-3 with variables of dimension 2 and 3, and a Hessian factor
+static GaussianFactorGraph createGraph() {
+  GaussianFactorGraph graph;
+  const SharedDiagonal model = noiseModel::Diagonal::Sigmas(Vector2(0.5, 2.0));
+  graph.emplace_shared<JacobianFactor>(0, (Matrix(2, 2) << 1, 2, 3, 4).finished(),
+                                       Vector2(1, 2), model);
+  graph.emplace_shared<JacobianFactor>(
+      0, (Matrix(2, 2) << 1, 0, 1, 1).finished(), 1,
+      (Matrix(2, 3) << 1, 2, 3, 0, 1, 0).finished(), Vector2(-1, 1), model);
+  graph.emplace_shared<JacobianFactor>(
+      1, (Matrix(2, 3) << 0, 1, 1, 2, 0, 1).finished(), 2,
+      (Matrix(2, 2) << 3, 1, 1, 2).finished(), Vector2(0.5, 1), model);
+  graph.emplace_shared<HessianFactor>(JacobianFactor(
+      2, (Matrix(2, 2) << 1, 1, 0, 1).finished(), 3,
+      (Matrix(2, 2) << 2, 0, 1, 1).finished(), Vector2(3, 4)));
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(BlockSparseMatrix, assemble) {
+  const GaussianFactorGraph graph = createGraph();
+  const Ordering ordering(KeyVector{3, 0, 2, 1});
+  const KeyInfo keyInfo(graph, ordering);
+  const BlockSparseMatrix H(graph, keyInfo);
+
+  EXPECT_LONGS_EQUAL(4, H.blockRows());
+  EXPECT_LONGS_EQUAL(9, H.rows());
+  EXPECT_LONGS_EQUAL(10, H.nonZeroBlocks());  // 4 diagonal, 3 x 2 off-diagonal
+  EXPECT(H.find(0, 1) == BlockSparseMatrix::kNotFound);
+  EXPECT(H.find(3, 1) != BlockSparseMatrix::kNotFound);
+
+  const pair<Matrix, Vector> expected = graph.hessian(ordering);
+  EXPECT(assert_equal(expected.first, H.dense(), 1e-9));
+  EXPECT(assert_equal(expected.second, H.informationVector(), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(BlockSparseMatrix, multiply) {
+  const GaussianFactorGraph graph = createGraph();
+  const KeyInfo keyInfo(graph);
+  const BlockSparseMatrix H(graph, keyInfo);
+
+  Vector x(9);
+  x << 1, -2, 3, 0.5, -1, 2, 4, -3, 1;
+  Vector y;
+  H.multiply(x, y);
+  EXPECT(assert_equal(Vector(graph.hessian(keyInfo.ordering()).first * x), y, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(BlockSparseMatrix, layout) {
+  // A factor without noise model is added without whitening
+  GaussianFactorGraph graph = createGraph();
+  graph.emplace_shared<JacobianFactor>(
+      3, (Matrix(1, 2) << 1, -1).finished(), 0,
+      (Matrix(1, 2) << 2, 1).finished(), Vector1(0.5));
+  const Ordering ordering(KeyVector{2, 3, 1, 0});
+  const KeyInfo keyInfo(graph, ordering);
+  const BlockSparseMatrix H(graph, keyInfo);
+
+  const pair<Matrix, Vector> expected = graph.hessian(ordering);
+  EXPECT(assert_equal(expected.first, H.dense(), 1e-9));
+  EXPECT(assert_equal(expected.second, H.informationVector(), 1e-9));
+
+  // Block rows are laid out as a FlatVectorValues in the given ordering
+  FlatVectorValues x(H.layout());
+  x.vector() = expected.second;
+  EXPECT_LONGS_EQUAL(4, x.size());
+  EXPECT_LONGS_EQUAL(H.offset(2), H.layout()->slots.at(1).offset);
+  EXPECT(assert_equal(Vector(expected.second.segment(H.offset(2), 3)),
+                      Vector(x.at(1))));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
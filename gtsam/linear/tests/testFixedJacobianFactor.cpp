@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testFixedJacobianFactor.cpp
+ * @brief   Unit tests for FixedJacobianFactor
+ * @date    Oct 17, 2026
+ */
+
+#include <gtsam/linear/FixedJacobianFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <boost/assign/list_of.hpp>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+using boost::assign::list_of;
+
+typedef FixedJacobianFactor<2, 6, 3> Fixed;  // e.g. a projection factor
+
+/* ************************************************************************* */
+// A factor and the same as a dynamic JacobianFactor
+static Fixed createFactor(JacobianFactor* dynamic,
+                           const SharedDiagonal& model = SharedDiagonal()) {
+  Fixed::AugmentedMatrix Ab;
+  for (DenseIndex i = 0; i < Ab.rows(); i++)
+    for (DenseIndex j = 0; j < Ab.cols(); j++) Ab(i, j) = sin(1.0 + i + 2.0 * j);
+  *dynamic = JacobianFactor(5, Ab.leftCols<6>(), 7, Ab.middleCols<3>(6),
+                            Ab.col(9), model);
+  return Fixed(list_of(5)(7), Ab, model);
+}
+
+/* ************************************************************************* */
+TEST(FixedJacobianFactor, constructor) {
+  JacobianFactor expected;
+  const Fixed actual = createFactor(&expected);
+  EXPECT(actual.isFixed());
+  EXPECT(assert_equal(expected, static_cast<const JacobianFactor&>(actual)));
+  EXPECT(assert_equal(expected.augmentedJacobian(),
+                      Matrix(actual.augmented())));
+  EXPECT(boost::dynamic_pointer_cast<Fixed>(actual.clone()));
+
+  Fixed::AugmentedMatrix Ab = Fixed::AugmentedMatrix::Zero();
+  CHECK_EXCEPTION(Fixed(list_of(5), Ab), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(FixedJacobianFactor, error) {
+  const SharedDiagonal model = noiseModel::Diagonal::Sigmas(Vector2(0.5, 2.0));
+  JacobianFactor expected;
+  const Fixed actual = createFactor(&expected, model);
+  VectorValues x;
+  x.insert(5, (Vector(6) << 1, 2, 3, 4, 5, 6).finished());
+  x.insert(7, Vector3(-1, 0.5, 2));
+  EXPECT_DOUBLES_EQUAL(expected.error(x), actual.error(x), 1e-9);
+}
+
+/* ************************************************************************* */
+TEST(FixedJacobianFactor, updateHessian) {
+  const SharedDiagonal model = noiseModel::Diagonal::Sigmas(Vector2(0.5, 2.0));
+  JacobianFactor dynamic;
+  const Fixed fixed = createFactor(&dynamic, model);
+
+  // Variables in the opposite order in the Hessian
+  const Ordering ordering = list_of(7)(5);
+  GaussianFactorGraph expected, actual;
+  expected += dynamic;
+  actual += fixed;
+  EXPECT(assert_equal(expected.augmentedHessian(ordering),
+                      actual.augmentedHessian(ordering), 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testFlatVectorValues.cpp
+ * @brief   Unit tests for FlatVectorValues
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/FlatVectorValues.h>
+#include <gtsam/base/Testable.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+static VectorValues example() {
+  VectorValues values;
+  values.insert(3, Vector3(1, 2, 3));
+  values.insert(0, Vector2(4, 5));
+  values.insert(7, (Vector(1) << 6).finished());
+  return values;
+}
+
+/* ************************************************************************* */
+TEST(FlatVectorValues, fromVectorValues) {
+  VectorValues values = example();
+  FlatVectorValues flat(values);
+
+  LONGS_EQUAL(3, flat.size());
+  LONGS_EQUAL(6, flat.dim());
+  LONGS_EQUAL(3, flat.dim(3));
+  EXPECT(flat.exists(7));
+  EXPECT(!flat.exists(1));
+
+  // Stored in key order
+  EXPECT(assert_equal((Vector(6) << 4, 5, 1, 2, 3, 6).finished(), flat.vector()));
+  EXPECT(assert_equal(Vector(Vector3(1, 2, 3)), Vector(flat.at(3))));
+  CHECK_EXCEPTION(flat.at(1), std::out_of_range);
+
+  // Write access through the view
+  flat[0] = Vector2(8, 9);
+  EXPECT(assert_equal((Vector(6) << 8, 9, 1, 2, 3, 6).finished(), flat.vector()));
+
+  values.at(0) = Vector2(8, 9);
+  EXPECT(assert_equal(values, flat.vectorValues()));
+}
+
+/* ************************************************************************* */
+TEST(FlatVectorValues, fromScatter) {
+  Scatter scatter;
+  scatter.add(5, 2);
+  scatter.add(1, 1);
+  FlatVectorValues flat(Vector3(1, 2, 3), scatter);
+
+  // Stored in scatter order
+  EXPECT(assert_equal(Vector(Vector2(1, 2)), Vector(flat.at(5))));
+  EXPECT(assert_equal(Vector(Vector1(3)), Vector(flat.at(1))));
+  EXPECT(assert_equal(VectorValues(Vector3(1, 2, 3), scatter), flat.vectorValues()));
+
+  CHECK_EXCEPTION(FlatVectorValues(Vector2(1, 2), scatter), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(FlatVectorValues, LinearAlgebra) {
+  VectorValues values = example();
+  FlatVectorValues x(values);
+  FlatVectorValues y = FlatVectorValues::Zero(x);
+  EXPECT(x.hasSameStructure(y));
+  EXPECT_DOUBLES_EQUAL(0.0, y.squaredNorm(), 1e-9);
+
+  // Same results as VectorValues
+  VectorValues other = 2.0 * values;
+  other.at(7) = Vector1(-1);
+  FlatVectorValues z(other);
+  EXPECT(x.hasSameStructure(z));
+  EXPECT_DOUBLES_EQUAL(values.dot(other), x.dot(z), 1e-9);
+  EXPECT_DOUBLES_EQUAL(values.norm(), x.norm(), 1e-9);
+  EXPECT_DOUBLES_EQUAL(values.squaredNorm(), x.squaredNorm(), 1e-9);
+  EXPECT(assert_equal(values + other, (x + z).vectorValues()));
+  EXPECT(assert_equal(values - other, (x - z).vectorValues()));
+  EXPECT(assert_equal(3.0 * values, (3.0 * x).vectorValues()));
+
+  y += x;
+  y *= 2.0;
+  axpy(-1.0, z, y);
+  EXPECT(assert_equal(2.0 * values - other, y.vectorValues()));
+
+  // Different structure
+  VectorValues different = values;
+  different.at(7) = Vector2(1, 2);
+  CHECK_EXCEPTION(x.dot(FlatVectorValues(different)), std::invalid_argument);
+  CHECK_EXCEPTION(x += FlatVectorValues(), std::invalid_argument);
+  EXPECT(!x.equals(FlatVectorValues(different)));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
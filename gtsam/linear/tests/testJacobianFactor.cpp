@@ -209,6 +209,34 @@ GaussianFactorGraph factors(list_of(factor1)(factor2)(factor3));
 Ordering ordering(list_of(keyX)(keyY)(keyZ));
 }
 
+/* ************************************************************************* */
+TEST(JacobianFactor, updateHessianFixedSize) {
+  // Factors on 6-dimensional variables take the fixed-size kernels
+  Matrix A1(6, 6), A2(6, 6);
+  for (DenseIndex i = 0; i < 6; i++)
+    for (DenseIndex j = 0; j < 6; j++) {
+      A1(i, j) = sin(1.0 + i + 3.0 * j) + (i == j ? 2.0 : 0.0);
+      A2(i, j) = cos(2.0 * i - j);
+    }
+  const Vector6 b = (Vector6() << 1, 2, 3, -1, -2, -3).finished();
+  GaussianFactorGraph jacobians;
+  jacobians += JacobianFactor(0, A1, b, noiseModel::Isotropic::Sigma(6, 0.5));
+  jacobians += JacobianFactor(2, A1, 0, -A2, b,
+                              noiseModel::Diagonal::Sigmas((Vector6() << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6).finished()));
+  jacobians += JacobianFactor(2, A2, 1, A1, -b);
+  jacobians += JacobianFactor(1, A2, 2, A1, b);
+
+  // The same, with the last factor as a HessianFactor
+  GaussianFactorGraph graph(jacobians.begin(), jacobians.begin() + 3);
+  graph += HessianFactor(JacobianFactor(1, A2, 2, A1, b));
+
+  const Ordering ordering = list_of(0)(1)(2);
+  const Matrix Ab = jacobians.augmentedJacobian(ordering);
+  const Matrix expected = Ab.transpose() * Ab;
+  EXPECT(assert_equal(expected, jacobians.augmentedHessian(ordering), 1e-9));
+  EXPECT(assert_equal(expected, graph.augmentedHessian(ordering), 1e-9));
+}
+
 /* ************************************************************************* */
 TEST( JacobianFactor, construct_from_graph)
 {
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testSchurComplementSolver.cpp
+ * @brief   Unit tests for SchurComplementSolver
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SchurComplementSolver.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::C;
+using symbol_shorthand::L;
+
+/* ************************************************************************* */
+// Cameras of dimension 6 observing landmarks of dimension 3, and a factor
+// between the last two landmarks
+static GaussianFactorGraph createGraph() {
+  GaussianFactorGraph graph;
+  auto matrix = [](size_t rows, size_t cols, double seed) {
+    Matrix A(rows, cols);
+    for (size_t r = 0; r < rows; ++r)
+      for (size_t c = 0; c < cols; ++c)
+        A(r, c) = sin(seed + 3.0 * r + 7.0 * c) + (r == c ? 2.0 : 0.0);
+    return A;
+  };
+  const size_t numCameras = 4, numLandmarks = 6;
+  for (size_t i = 0; i < numCameras; ++i)
+    graph.emplace_shared<JacobianFactor>(C(i), matrix(6, 6, i),
+                                         Vector::Constant(6, i));
+  for (size_t j = 0; j < numLandmarks; ++j)
+    for (size_t i = 0; i < numCameras; ++i)
+      if ((i + j) % 3 != 0)
+        graph.emplace_shared<JacobianFactor>(
+            C(i), matrix(2, 6, i + 10.0 * j), L(j), matrix(2, 3, j - 1.0 * i),
+            Vector2(i, -1.0 * j));
+  graph.emplace_shared<JacobianFactor>(L(4), I_3x3, L(5), -I_3x3,
+                                       Vector3(1, 2, 3));
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(SchurComplementSolver, optimize) {
+  const GaussianFactorGraph graph = createGraph();
+  KeyVector candidates;
+  for (size_t j = 0; j < 6; ++j) candidates.push_back(L(j));
+  SchurComplementSolver solver(graph, candidates);
+
+  // The landmarks that share a factor stay in the reduced system
+  EXPECT(KeyVector({L(0), L(1), L(2), L(3)}) == solver.eliminated());
+  const KeySet reducedKeys = solver.reducedSystem().keys();
+  EXPECT_LONGS_EQUAL(4 + 2, reducedKeys.size());
+  EXPECT(!reducedKeys.count(L(0)));
+  EXPECT(reducedKeys.count(L(5)));
+
+  const VectorValues expected = graph.optimize();
+  EXPECT(assert_equal(expected, solver.optimize(), 1e-8));
+
+  // The reduced system can be solved by any solver, e.g., PCG
+  PCGSolverParameters parameters;
+  parameters.preconditioner_ =
+      boost::make_shared<BlockJacobiPreconditionerParameters>();
+  parameters.setEpsilon_abs(1e-12);
+  parameters.setEpsilon_rel(1e-12);
+  const VectorValues reducedSolution =
+      PCGSolver(parameters).optimize(solver.reducedSystem());
+  EXPECT(assert_equal(expected, solver.backSubstitute(reducedSolution), 1e-6));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
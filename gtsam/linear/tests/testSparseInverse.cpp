@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testSparseInverse.cpp
+ * @brief   Unit tests for SparseInverse
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SparseInverse.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// A chain of 3-dimensional variables with loop closures and a 2-dimensional
+// landmark, such that the Bayes tree has several branches and separators
+static GaussianFactorGraph createGraph() {
+  GaussianFactorGraph graph;
+  const SharedDiagonal model = noiseModel::Isotropic::Sigma(3, 0.5);
+  Matrix3 A;
+  A << 1, 0.2, 0, -0.1, 1, 0.3, 0, 0.1, 2;
+  graph.add(0, Matrix3::Identity() * 3, Vector3(1, 2, 3), model);
+  for (Key i = 1; i < 12; ++i) {
+    const Matrix3 B = A * cos(0.3 * i) - Matrix3::Identity();
+    graph.add(i - 1, B, i, A, Vector3(0.1 * i, 1, -0.2), model);
+    if (i >= 4 && i % 4 == 0)
+      graph.add(i - 4, A.transpose(), i, -Matrix3::Identity(), Vector3::Ones(),
+                model);
+  }
+  Matrix23 C;
+  C << 1, 0, 0.5, 0, 1, -0.5;
+  graph.add(5, C, 20, Matrix2::Identity(), Vector2(0.3, 0.4),
+            noiseModel::Unit::Create(2));
+  graph.add(9, C, 20, -Matrix2::Identity(), Vector2(-0.1, 0.2),
+            noiseModel::Unit::Create(2));
+  return graph;
+}
+
+/* ************************************************************************* */
+// The covariance block of i and j of the dense inverse of the information
+static Matrix denseBlock(const GaussianFactorGraph& graph, Key i, Key j) {
+  const Ordering ordering(graph.keys());
+  const Matrix covariance = graph.hessian(ordering).first.inverse();
+  const map<Key, size_t> dims = graph.getKeyDimMap();
+  DenseIndex row = 0, col = 0;
+  for (Key key : ordering) {
+    if (key == i) break;
+    row += dims.at(key);
+  }
+  for (Key key : ordering) {
+    if (key == j) break;
+    col += dims.at(key);
+  }
+  return covariance.block(row, col, dims.at(i), dims.at(j));
+}
+
+/* ************************************************************************* */
+TEST(SparseInverse, all) {
+  const GaussianFactorGraph graph = createGraph();
+  const GaussianBayesTree bayesTree = *graph.eliminateMultifrontal();
+  const SparseInverse sparseInverse(bayesTree);
+
+  for (Key key : graph.keys()) {
+    EXPECT(sparseInverse.exists(key));
+    EXPECT(assert_equal(denseBlock(graph, key, key),
+                        sparseInverse.marginalCovariance(key), 1e-9));
+  }
+
+  // Cross-covariances of the variables of every clique
+  for (Key key : graph.keys()) {
+    const CliqueCovariance& clique = sparseInverse.clique(key);
+    for (Key other : clique.keys())
+      EXPECT(assert_equal(denseBlock(graph, key, other),
+                          sparseInverse.jointCovariance(key, other), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+TEST(SparseInverse, some) {
+  const GaussianFactorGraph graph = createGraph();
+  const GaussianBayesTree bayesTree = *graph.eliminateMultifrontal();
+  const SparseInverse sparseInverse(bayesTree, KeyVector{3, 20});
+
+  EXPECT(assert_equal(denseBlock(graph, 3, 3),
+                      sparseInverse.marginalCovariance(3), 1e-9));
+  EXPECT(assert_equal(denseBlock(graph, 20, 20),
+                      sparseInverse.marginalCovariance(20), 1e-9));
+
+  // Only the cliques of the requested variables and their ancestors are
+  // recovered
+  size_t recovered = 0;
+  for (Key key : graph.keys())
+    if (sparseInverse.exists(key)) ++recovered;
+  EXPECT(recovered < graph.keys().size());
+  CHECK_EXCEPTION(sparseInverse.marginalCovariance(0), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testSupernodalCholesky.cpp
+ * @brief   Unit tests for SupernodalCholesky
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/linear/SupernodalCholesky.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+
+static const SharedDiagonal unit2 = noiseModel::Unit::Create(2);
+
+/* ************************************************************************* */
+// A grid-like graph with variables of dimension 2 and 3, and loops, such that
+// elimination creates several supernodes with fill-in
+static GaussianFactorGraph createGraph(double scale = 1.0) {
+  GaussianFactorGraph graph;
+  auto dim = [](Key j) { return j % 3 == 0 ? 3 : 2; };
+  auto matrix = [&](Key i, Key j, size_t rows) {
+    Matrix A(rows, dim(j));
+    for (DenseIndex r = 0; r < A.rows(); ++r)
+      for (DenseIndex c = 0; c < A.cols(); ++c)
+        A(r, c) = scale * (std::sin(1.0 + i + 2.0 * j + 3.0 * r + 5.0 * c) +
+                           (r == c ? 2.0 : 0.0));
+    return A;
+  };
+  const size_t n = 12;
+  for (Key j = 0; j < n; ++j) {
+    graph.emplace_shared<JacobianFactor>(j, matrix(j, j, dim(j)),
+                                         Vector::Ones(dim(j)) * j);
+    if (j + 1 < n)
+      graph.emplace_shared<JacobianFactor>(j, matrix(j, j, 2), j + 1,
+                                           matrix(j, j + 1, 2),
+                                           Vector2(1.0, -double(j)), unit2);
+    if (j + 4 < n)
+      graph.emplace_shared<JacobianFactor>(j, matrix(j + 4, j, 2), j + 4,
+                                           matrix(j, j + 4, 2), Vector2(0.5, 2.0),
+                                           unit2);
+  }
+  // A Hessian factor on three variables
+  graph.emplace_shared<HessianFactor>(
+      JacobianFactor(1, matrix(1, 1, 3), 6, matrix(1, 6, 3), 10,
+                     matrix(6, 10, 3), Vector3(1, 2, 3)));
+  return graph;
+}
+
+/* ************************************************************************* */
+// A graph where merging cliques puts the first frontal of the root, 0, before
+// that of its child, 1, in the ordering {0,1,2,3}
+static GaussianFactorGraph createMergedGraph() {
+  GaussianFactorGraph graph;
+  auto matrix = [](double a) {
+    return (Matrix2() << 1.0 + a, 0.3 * a, -0.2 * a, 1.5 - a).finished();
+  };
+  for (Key j = 0; j < 4; ++j)
+    graph.emplace_shared<JacobianFactor>(j, matrix(0.1 * j), Vector2(1, j));
+  const vector<pair<Key, Key> > edges{{0, 2}, {0, 3}, {1, 2}, {2, 3}};
+  for (size_t e = 0; e < edges.size(); ++e)
+    graph.emplace_shared<JacobianFactor>(
+        edges[e].first, matrix(0.2 * e), edges[e].second, -matrix(0.3 - 0.1 * e),
+        Vector2(0.5 * e, 1.0 - e), unit2);
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(SupernodalCholesky, optimize) {
+  GaussianFactorGraph graph = createGraph();
+  for (const Ordering& ordering :
+       {Ordering::Colamd(graph), Ordering::Natural(graph)}) {
+    SupernodalCholesky solver(graph, ordering);
+    EXPECT(solver.supernodes().size() > 1);
+    EXPECT(solver.supernodes().size() < ordering.size());
+    VectorValues expected = graph.optimize(ordering);
+    EXPECT(assert_equal(expected, solver.optimize(graph), 1e-8));
+  }
+}
+
+/* ************************************************************************* */
+TEST(SupernodalCholesky, mergedCliques) {
+  GaussianFactorGraph graph = createMergedGraph();
+  const Ordering ordering(KeyVector{0, 1, 2, 3});
+  SupernodalCholesky solver(graph, ordering);
+
+  // The child supernode has to be factorized before the root
+  EXPECT_LONGS_EQUAL(2, solver.supernodes().size());
+  EXPECT(solver.supernodes().front().frontals == KeyVector{1});
+  EXPECT_LONGS_EQUAL(3, solver.supernodes().back().frontals.size());
+  EXPECT(assert_equal(graph.optimize(ordering), solver.optimize(graph), 1e-8));
+}
+
+/* ************************************************************************* */
+TEST(SupernodalCholesky, refactorize) {
+  GaussianFactorGraph graph = createGraph();
+  const Ordering ordering = Ordering::Colamd(graph);
+  SupernodalCholesky solver(graph, ordering);
+  solver.factorize(graph);
+
+  // Same structure, different values
+  GaussianFactorGraph other = createGraph(2.0);
+  EXPECT(solver.hasSameStructure(other));
+  EXPECT(assert_equal(other.optimize(ordering), solver.optimize(other), 1e-8));
+
+  // Different structure
+  other.emplace_shared<JacobianFactor>(0, Matrix3::Identity(), Vector3::Zero());
+  EXPECT(!solver.hasSameStructure(other));
+  CHECK_EXCEPTION(solver.factorize(other), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(SupernodalCholesky, damped) {
+  const GaussianFactorGraph grid = createGraph();
+  const vector<pair<GaussianFactorGraph, Ordering> > problems{
+      {grid, Ordering::Colamd(grid)},
+      {createMergedGraph(), Ordering(KeyVector{0, 1, 2, 3})}};
+  for (const auto& problem : problems) {
+    const GaussianFactorGraph& graph = problem.first;
+    const Ordering& ordering = problem.second;
+    SupernodalCholesky solver(graph, ordering);
+    solver.assemble(graph);
+
+    // Damping the assembled system is the same as adding prior factors
+    const VectorValues zero = VectorValues::Zero(graph.optimize(ordering));
+    VectorValues diagonal = zero;
+    for (auto& key_value : diagonal) key_value.second.setConstant(key_value.first + 1.0);
+    for (double lambda : {1e-3, 1.0, 1e3}) {
+      GaussianFactorGraph damped = graph, dampedDiagonal = graph;
+      for (const auto& key_value : zero) {
+        const size_t dim = key_value.second.size();
+        const Matrix I = Matrix::Identity(dim, dim);
+        const SharedDiagonal model =
+            noiseModel::Isotropic::Sigma(dim, 1.0 / std::sqrt(lambda));
+        damped.emplace_shared<JacobianFactor>(key_value.first, I,
+                                              key_value.second, model);
+        const Matrix D = diagonal.at(key_value.first).cwiseSqrt().asDiagonal();
+        dampedDiagonal.emplace_shared<JacobianFactor>(key_value.first, D,
+                                                      key_value.second, model);
+      }
+      solver.factorizeDamped(lambda);
+      EXPECT(assert_equal(damped.optimize(ordering), solver.solve(), 1e-8));
+      solver.factorizeDamped(lambda, &diagonal);
+      EXPECT(assert_equal(dampedDiagonal.optimize(ordering), solver.solve(), 1e-8));
+    }
+  }
+}
+
+/* ************************************************************************* */
+TEST(SupernodalCholesky, indeterminant) {
+  GaussianFactorGraph graph;
+  graph.emplace_shared<JacobianFactor>(0, Matrix2::Identity(), Vector2(1, 2));
+  graph.emplace_shared<JacobianFactor>(0, Matrix2::Identity(), 1,
+                                       Matrix2::Zero(), Vector2(1, 2));
+  SupernodalCholesky solver(graph, Ordering::Natural(graph));
+  CHECK_EXCEPTION(solver.factorize(graph), IndeterminantLinearSystemException);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
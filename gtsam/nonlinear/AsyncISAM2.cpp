@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    AsyncISAM2.cpp
+ * @brief   ISAM2 that relinearizes on a background thread
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/nonlinear/AsyncISAM2.h>
+
+#include <chrono>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+static ISAM2Params foregroundParams(const ISAM2Params& params) {
+  ISAM2Params result = params;
+  result.enableRelinearization = false;
+  return result;
+}
+
+/* ************************************************************************* */
+AsyncISAM2::AsyncISAM2(const ISAM2Params& params)
+    : params_(params),
+      isam_(new ISAM2(foregroundParams(params))),
+      updatesSinceRelinearization_(0),
+      relinearizationRequested_(false),
+      nrRelinearizations_(0) {}
+
+/* ************************************************************************* */
+AsyncISAM2::~AsyncISAM2() {
+  // The background thread uses background_, do not destroy it under its feet
+  if (relinearization_.valid()) relinearization_.wait();
+}
+
+/* ************************************************************************* */
+ISAM2Result AsyncISAM2::update(const NonlinearFactorGraph& newFactors,
+                               const Values& newTheta,
+                               const ISAM2UpdateParams& updateParams) {
+  swapIfFinished(false);
+
+  ISAM2UpdateParams foreground = updateParams;
+  foreground.force_relinearize = false;
+  ISAM2Result result = isam_->update(newFactors, newTheta, foreground);
+
+  // Record the update for replay on the background result
+  if (relinearizing())
+    pending_.push_back(PendingUpdate{newFactors, newTheta, foreground});
+
+  // A forced relinearization is served by the next background run that starts
+  // after this update, the running one (if any) does not include it
+  if (updateParams.force_relinearize) relinearizationRequested_ = true;
+
+  ++updatesSinceRelinearization_;
+  if (!relinearizing() &&
+      (relinearizationRequested_ ||
+       (params_.enableRelinearization &&
+        updatesSinceRelinearization_ >= params_.relinearizeSkip)))
+    startRelinearization();
+
+  return result;
+}
+
+/* ************************************************************************* */
+void AsyncISAM2::waitForRelinearization() {
+  if (!relinearizing()) startRelinearization();
+  swapIfFinished(true);
+}
+
+/* ************************************************************************* */
+void AsyncISAM2::startRelinearization() {
+  background_.reset(new ISAM2(*isam_));
+  pending_.clear();
+  updatesSinceRelinearization_ = 0;
+  relinearizationRequested_ = false;
+
+  ISAM2* isam = background_.get();
+  relinearization_ = std::async(std::launch::async, [isam]() {
+    ISAM2UpdateParams updateParams;
+    updateParams.force_relinearize = true;
+    isam->update(NonlinearFactorGraph(), Values(), updateParams);
+  });
+}
+
+/* ************************************************************************* */
+bool AsyncISAM2::swapIfFinished(bool wait) {
+  if (!relinearization_.valid()) return false;
+  if (!wait && relinearization_.wait_for(std::chrono::seconds(0)) !=
+                   std::future_status::ready)
+    return false;
+
+  // Rethrows any exception thrown on the background thread
+  try {
+    relinearization_.get();
+  } catch (...) {
+    background_.reset();
+    pending_.clear();
+    throw;
+  }
+
+  // Bring the relinearized copy up to date, in the original order, so that
+  // factor indices match those returned by the foreground ISAM2
+  for (const PendingUpdate& pending : pending_)
+    background_->update(pending.newFactors, pending.newTheta,
+                        pending.updateParams);
+  pending_.clear();
+
+  isam_ = std::move(background_);
+  ++nrRelinearizations_;
+  return true;
+}
+
+}  // namespace gtsam
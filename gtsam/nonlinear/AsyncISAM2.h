@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    AsyncISAM2.h
+ * @brief   ISAM2 that relinearizes on a background thread
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/ISAM2.h>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * @addtogroup ISAM2
+ * An incremental smoother that moves the relinearization of ISAM2 off the
+ * caller's thread.
+ *
+ * A foreground ISAM2 absorbs new factors at the current linearization point
+ * and never relinearizes by itself, so that update() and calculateEstimate()
+ * have a latency that only depends on the size of the new factors.  Every
+ * ISAM2Params::relinearizeSkip updates, the foreground ISAM2 is copied and the
+ * copy is relinearized and re-eliminated on a background thread, as ISAM2 would
+ * do with force_relinearize.  Updates made in the mean time are recorded, and
+ * once the background thread finishes, they are replayed on the relinearized
+ * copy, which then replaces the foreground ISAM2 at the start of the next call
+ * to update().  Since no variables are relinearized during the replay, the
+ * swap only costs the (small) recorded updates.
+ *
+ * Factor indices returned by update() remain valid across swaps.  Factors that
+ * cache their linearization internally, such as smart factors, are linearized
+ * from both threads and should not be used with this class.
+ */
+class GTSAM_EXPORT AsyncISAM2 {
+ protected:
+  /** An update recorded while a relinearization is running */
+  struct PendingUpdate {
+    NonlinearFactorGraph newFactors;
+    Values newTheta;
+    ISAM2UpdateParams updateParams;
+  };
+
+  ISAM2Params params_;  ///< Parameters, as given by the user
+
+  /** The ISAM2 answering update() and calculateEstimate(), never relinearizes */
+  std::unique_ptr<ISAM2> isam_;
+
+  /** The copy being relinearized, only touched by the background thread while
+   * relinearization_ is valid */
+  std::unique_ptr<ISAM2> background_;
+
+  std::future<void> relinearization_;  ///< The running background task
+  std::vector<PendingUpdate> pending_;  ///< Updates made since the copy
+  int updatesSinceRelinearization_;    ///< Updates since the last launch
+  bool relinearizationRequested_;      ///< force_relinearize not yet served
+  size_t nrRelinearizations_;          ///< Number of swapped-in results
+
+ public:
+  /** Create an empty instance, relinearizing according to \c params */
+  explicit AsyncISAM2(const ISAM2Params& params = ISAM2Params());
+
+  /** Waits for a running relinearization to finish */
+  virtual ~AsyncISAM2();
+
+  AsyncISAM2(const AsyncISAM2&) = delete;
+  AsyncISAM2& operator=(const AsyncISAM2&) = delete;
+
+  /**
+   * Add new factors and variables, as ISAM2::update().  If a background
+   * relinearization has finished, its result is swapped in first, and a new
+   * one is started every ISAM2Params::relinearizeSkip calls.  With
+   * force_relinearize set in \c updateParams, a relinearization including
+   * this update is started right away, or, if one is already running, as soon
+   * as that one is swapped in.  Like ISAM2, this does not block the caller;
+   * call waitForRelinearization() to wait for the result.
+   */
+  ISAM2Result update(
+      const NonlinearFactorGraph& newFactors = NonlinearFactorGraph(),
+      const Values& newTheta = Values(),
+      const ISAM2UpdateParams& updateParams = ISAM2UpdateParams());
+
+  /** Current estimate of all variables, from the foreground ISAM2 */
+  Values calculateEstimate() const { return isam_->calculateEstimate(); }
+
+  /** Current estimate of a single variable, from the foreground ISAM2 */
+  template <class VALUE>
+  VALUE calculateEstimate(Key key) const {
+    return isam_->calculateEstimate<VALUE>(key);
+  }
+
+  /** Whether a relinearization is running on the background thread */
+  bool relinearizing() const { return relinearization_.valid(); }
+
+  /**
+   * Start a relinearization if none is running, wait until it finishes and
+   * swap in its result.  Blocks the caller, mostly useful at the end of a run
+   * or in tests.
+   */
+  void waitForRelinearization();
+
+  /** Number of relinearizations that have been swapped in so far */
+  size_t nrRelinearizations() const { return nrRelinearizations_; }
+
+  /** The foreground ISAM2, valid until the next call to update() */
+  const ISAM2& isam() const { return *isam_; }
+
+  /** The parameters given to the constructor */
+  const ISAM2Params& params() const { return params_; }
+
+ protected:
+  /** Copy the foreground ISAM2 and relinearize the copy on a new thread */
+  void startRelinearization();
+
+  /** If the background thread is done (or if \c wait), replay the pending
+   * updates on its result and make it the foreground ISAM2 */
+  bool swapIfFinished(bool wait);
+};
+
+}  // namespace gtsam
@@ -21,8 +21,10 @@
 
 #include <gtsam/nonlinear/Expression.h>
 #include <gtsam/nonlinear/NonlinearFactor.h>
+#include <gtsam/linear/RegularJacobianFactor.h>
 #include <gtsam/base/Testable.h>
 #include <numeric>
+#include <type_traits>
 
 namespace gtsam {
 
@@ -100,41 +102,7 @@ protected:
   }
 
   virtual boost::shared_ptr<GaussianFactor> linearize(const Values& x) const {
-    // Only linearize if the factor is active
-    if (!active(x))
-      return boost::shared_ptr<JacobianFactor>();
-
-    // In case noise model is constrained, we need to provide a noise model
-    SharedDiagonal noiseModel;
-    if (noiseModel_ && noiseModel_->isConstrained()) {
-      noiseModel = boost::static_pointer_cast<noiseModel::Constrained>(
-          noiseModel_)->unit();
-    }
-
-    // Create a writeable JacobianFactor in advance
-    boost::shared_ptr<JacobianFactor> factor(
-        new JacobianFactor(keys_, dims_, Dim, noiseModel));
-
-    // Wrap keys and VerticalBlockMatrix into structure passed to expression_
-    VerticalBlockMatrix& Ab = factor->matrixObject();
-    internal::JacobianMap jacobianMap(keys_, Ab);
-
-    // Zero out Jacobian so we can simply add to it
-    Ab.matrix().setZero();
-
-    // Get value and Jacobians, writing directly into JacobianFactor
-    T value = expression_.valueAndJacobianMap(x, jacobianMap); // <<< Reverse AD happens here !
-
-    // Evaluate error and set RHS vector b
-    Ab(size()).col(0) = traits<T>::Local(value, measured_);
-
-    // Whiten the corresponding system, Ab already contains RHS
-    if (noiseModel_) {
-      Vector b = Ab(size()).col(0);  // need b to be valid for Robust noise models
-      noiseModel_->WhitenSystem(Ab.matrix(), b);
-    }
-
-    return factor;
+    return linearizeInto<JacobianFactor>(x);
   }
 
   /// @return a deep copy of this factor
@@ -144,6 +112,86 @@ protected:
   }
 
 protected:
+ /// Number of columns of the largest [A b] that is linearized on the stack
+ static const int kMaxStackColumns = 32;
+
+ /**
+  * Linearize into a factor of type LINEAR, a JacobianFactor or a
+  * RegularJacobianFactor.  If the dimension of T is known at compile time,
+  * [A b] is small, and the noise model is diagonal, the Jacobians are written
+  * directly into a fixed-size matrix on the stack, and whitened there, such
+  * that the only allocation is the one of the factor.  Full Gaussian, robust
+  * and constrained noise models take the dynamic path.
+  */
+ template <class LINEAR>
+ boost::shared_ptr<GaussianFactor> linearizeInto(const Values& x) const {
+   // Only linearize if the factor is active
+   if (!active(x))
+     return boost::shared_ptr<JacobianFactor>();
+
+   const int cols = std::accumulate(dims_.begin(), dims_.end(), 1);
+   const noiseModel::Diagonal* diagonal =
+       dynamic_cast<const noiseModel::Diagonal*>(noiseModel_.get());
+   if (Dim == Eigen::Dynamic || cols > kMaxStackColumns || !diagonal ||
+       diagonal->isConstrained())
+     return linearizeDynamic(x);
+
+   // Jacobians by reverse AD, and the RHS, into [A b] on the stack
+   typedef Eigen::Matrix<double, Dim, Eigen::Dynamic,
+                         Dim == 1 ? Eigen::RowMajor : Eigen::ColMajor, Dim,
+                         kMaxStackColumns> StackMatrix;
+   StackMatrix Ab = StackMatrix::Zero(Dim, cols);
+   DenseIndex offsets[kMaxStackColumns + 1];
+   offsets[0] = 0;
+   for (size_t i = 0; i < dims_.size(); ++i)
+     offsets[i + 1] = offsets[i] + dims_[i];
+   internal::JacobianMap jacobianMap(keys_, Ab.data(), Dim, offsets);
+   const T value = expression_.valueAndJacobianMap(x, jacobianMap);
+   Ab.col(cols - 1) = traits<T>::Local(value, measured_);
+
+   // Whiten in place, the fixed-size block is scaled row by row
+   if (!diagonal->isUnit()) Ab = diagonal->invsigmas().asDiagonal() * Ab;
+
+   boost::shared_ptr<LINEAR> factor(new LINEAR(keys_, dims_, Dim));
+   factor->matrixObject().matrix() = Ab;
+   return factor;
+ }
+
+ /// Linearize into a dynamic VerticalBlockMatrix, for all other cases
+ boost::shared_ptr<GaussianFactor> linearizeDynamic(const Values& x) const {
+   // In case noise model is constrained, we need to provide a noise model
+   SharedDiagonal noiseModel;
+   if (noiseModel_ && noiseModel_->isConstrained()) {
+     noiseModel = boost::static_pointer_cast<noiseModel::Constrained>(
+         noiseModel_)->unit();
+   }
+
+   // Create a writeable JacobianFactor in advance
+   boost::shared_ptr<JacobianFactor> factor(
+       new JacobianFactor(keys_, dims_, Dim, noiseModel));
+
+   // Wrap keys and VerticalBlockMatrix into structure passed to expression_
+   VerticalBlockMatrix& Ab = factor->matrixObject();
+   internal::JacobianMap jacobianMap(keys_, Ab);
+
+   // Zero out Jacobian so we can simply add to it
+   Ab.matrix().setZero();
+
+   // Get value and Jacobians, writing directly into JacobianFactor
+   T value = expression_.valueAndJacobianMap(x, jacobianMap); // <<< Reverse AD happens here !
+
+   // Evaluate error and set RHS vector b
+   Ab(size()).col(0) = traits<T>::Local(value, measured_);
+
+   // Whiten the corresponding system, Ab already contains RHS
+   if (noiseModel_) {
+     Vector b = Ab(size()).col(0);  // need b to be valid for Robust noise models
+     noiseModel_->WhitenSystem(Ab.matrix(), b);
+   }
+
+   return factor;
+ }
+
  ExpressionFactor() {}
  /// Default constructor, for serialization
 
@@ -224,6 +272,14 @@ struct traits<ExpressionFactor<T> > : public Testable<ExpressionFactor<T> > {};
  */
 template <typename T, typename A1, typename A2>
 class ExpressionFactor2 : public ExpressionFactor<T> {
+  static const int D1 = traits<A1>::dimension;
+  static const int D2 = traits<A2>::dimension;
+
+  /// The type of linear factor, regular if possible
+  typedef typename std::conditional<(D1 == D2 && D1 > 0),
+                                    RegularJacobianFactor<(D1 > 0 ? D1 : 1)>,
+                                    JacobianFactor>::type Linear;
+
  public:
   /// Destructor
   virtual ~ExpressionFactor2() {}
@@ -242,6 +298,14 @@ class ExpressionFactor2 : public ExpressionFactor<T> {
     return error;
   }
 
+  /**
+   * Linearize as ExpressionFactor does, into a RegularJacobianFactor if both
+   * arguments have the same dimension, known at compile time.
+   */
+  virtual boost::shared_ptr<GaussianFactor> linearize(const Values& x) const {
+    return this->template linearizeInto<Linear>(x);
+  }
+
   /// Recreate expression from given keys_ and measured_, used in load
   /// Needed to deserialize a derived factor
   virtual Expression<T> expression(Key key1, Key key2) const {
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FactorBatch.h
+ * @brief   Evaluate many factors of the same type of a graph at once
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/inference/Factor.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <vector>
+
+namespace gtsam {
+
+// Forward declarations
+class GaussianFactorGraph;
+class Values;
+
+/**
+ * A copy of some of the factors of a NonlinearFactorGraph, all of the same
+ * type, stored such that their errors and linearizations can be computed in
+ * one loop, without a virtual call per factor, see e.g. BetweenFactorBatch.
+ *
+ * NonlinearFactorGraph::error and NonlinearFactorGraph::linearize take a list
+ * of batches, and evaluate the factors they cover through them.  A batch
+ * refers to its factors by their index in the graph, and has to be created
+ * again when the graph changes.
+ * @addtogroup nonlinear
+ */
+class GTSAM_EXPORT FactorBatch {
+ public:
+  typedef boost::shared_ptr<FactorBatch> shared_ptr;
+
+  virtual ~FactorBatch() {}
+
+  /// Indices of the factors in the graph, in the order of the batch
+  const FactorIndices& indices() const { return indices_; }
+
+  /// Number of factors in the batch
+  size_t size() const { return indices_.size(); }
+
+  /// Sum of the errors of the factors, as NonlinearFactor::error
+  virtual double error(const Values& values) const = 0;
+
+  /// Linearize every factor into (*linear)[indices()[i]], which has to exist
+  virtual void linearizeInto(const Values& values,
+                             GaussianFactorGraph* linear) const = 0;
+
+ protected:
+  FactorIndices indices_;  ///< Index of every factor in the graph
+};
+
+/// A list of batches, covering disjoint factors of a graph
+typedef std::vector<FactorBatch::shared_ptr> FactorBatches;
+
+}  // namespace gtsam
@@ -24,6 +24,7 @@
 
 #include <boost/range/adaptors.hpp>
 #include <functional>
+#include <vector>
 #include <limits>
 #include <string>
 
@@ -31,6 +32,35 @@ using namespace std;
 
 namespace gtsam {
 
+/* ************************************************************************* */
+ISAM2Executor::ISAM2Executor(int numThreads) {
+#ifdef GTSAM_USE_TBB
+  if (numThreads == 0)
+    arena_ = std::make_shared<tbb::task_arena>();
+  else if (numThreads > 1)
+    arena_ = std::make_shared<tbb::task_arena>(numThreads);
+#elif defined GTSAM_USE_THREAD_POOL
+  pool_ = nullptr;
+  if (numThreads == 0) {
+    pool_ = &ThreadPool::Global();
+  } else if (numThreads > 1) {
+    ownPool_ = std::make_shared<ThreadPool>(numThreads);
+    pool_ = ownPool_.get();
+  }
+#endif
+}
+
+/* ************************************************************************* */
+bool ISAM2Executor::parallel() const {
+#ifdef GTSAM_USE_TBB
+  return static_cast<bool>(arena_);
+#elif defined GTSAM_USE_THREAD_POOL
+  return pool_ && pool_->numThreads() > 1;
+#else
+  return false;
+#endif
+}
+
 /* ************************************************************************* */
 namespace internal {
 inline static void optimizeInPlace(const ISAM2::sharedClique& clique,
@@ -44,14 +74,67 @@ inline static void optimizeInPlace(const ISAM2::sharedClique& clique,
 }
 }  // namespace internal
 
+/* ************************************************************************* */
+namespace internal {
+// Back-substitute the Bayes tree level by level, the cliques of each level in
+// parallel. A clique only depends on its ancestors, which are all solved in
+// earlier levels, so changed keys are recorded after each level.
+static size_t optimizeWildfireParallel(const ISAM2::Roots& roots,
+                                       double threshold,
+                                       const KeySet& replaced,
+                                       VectorValues* delta,
+                                       const ISAM2Executor& executor) {
+  KeySet changed;
+  size_t count = 0;
+  std::vector<ISAM2::sharedClique> level(roots.begin(), roots.end()), next;
+  std::vector<char> dirty, frontalsChanged;
+  while (!level.empty()) {
+    dirty.assign(level.size(), 0);
+    frontalsChanged.assign(level.size(), 0);
+    executor.parallelFor(level.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        if (threshold <= 0.0) {
+          delta->update(level[i]->conditional()->solve(*delta));
+          dirty[i] = true;
+        } else {
+          bool changedI = false;
+          dirty[i] = level[i]->optimizeWildfireNode(replaced, threshold,
+                                                    changed, delta, &changedI);
+          frontalsChanged[i] = changedI;
+        }
+      }
+    });
+
+    next.clear();
+    for (size_t i = 0; i < level.size(); ++i) {
+      if (!dirty[i]) continue;
+      const auto& conditional = level[i]->conditional();
+      count += conditional->nrFrontals();
+      if (frontalsChanged[i])
+        changed.insert(conditional->beginFrontals(), conditional->endFrontals());
+      next.insert(next.end(), level[i]->children.begin(),
+                  level[i]->children.end());
+    }
+    level.swap(next);
+  }
+  return count;
+}
+}  // namespace internal
+
 /* ************************************************************************* */
 size_t DeltaImpl::UpdateGaussNewtonDelta(const ISAM2::Roots& roots,
                                            const KeySet& replacedKeys,
                                            double wildfireThreshold,
-                                           VectorValues* delta) {
+                                           VectorValues* delta,
+                                           const ISAM2Executor& executor) {
   size_t lastBacksubVariableCount;
 
-  if (wildfireThreshold <= 0.0) {
+  if (executor.parallel()) {
+    lastBacksubVariableCount = internal::optimizeWildfireParallel(
+        roots, wildfireThreshold, replacedKeys, delta, executor);
+    if (wildfireThreshold <= 0.0) lastBacksubVariableCount = delta->size();
+
+  } else if (wildfireThreshold <= 0.0) {
     // Threshold is zero or less, so do a full recalculation
     for (const ISAM2::sharedClique& root : roots)
       internal::optimizeInPlace(root, delta);
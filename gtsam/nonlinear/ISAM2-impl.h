@@ -22,6 +22,7 @@
 #include <gtsam/nonlinear/ISAM2Result.h>
 
 #include <gtsam/base/debug.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB and GTSAM_USE_THREAD_POOL
 #include <gtsam/inference/JunctionTree-inst.h>  // We need the inst file because we'll make a special JT templated on ISAM2
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/inference/VariableIndex.h>
@@ -35,10 +36,22 @@ using namespace boost::range;
 using namespace boost::adaptors;
 }  // namespace br
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#elif defined GTSAM_USE_THREAD_POOL
+#include <gtsam/base/ThreadPool.h>
+#endif
+
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace gtsam {
 
@@ -68,6 +81,55 @@ class ISAM2JunctionTree
       : Base(eliminationTree) {}
 };
 
+/* ************************************************************************* */
+/**
+ * Runs the parallel loops of ISAM2::update, on TBB or the std::thread pool,
+ * with the number of threads given by ISAM2Params::numThreads.
+ */
+class GTSAM_EXPORT ISAM2Executor {
+ public:
+  /// 0: TBB default or global ThreadPool, -1 or 1: serial, N: at most N threads
+  explicit ISAM2Executor(int numThreads);
+
+  /// Whether loops are executed in parallel at all
+  bool parallel() const;
+
+  /**
+   * Call function(i0, i1) on sub-ranges [i0, i1) of [0, n), in parallel if
+   * enabled, and wait for all of them.
+   */
+  template <typename FUNCTION>
+  void parallelFor(size_t n, const FUNCTION& function) const {
+    if (n > 1) {
+#ifdef GTSAM_USE_TBB
+      if (arena_) {
+        arena_->execute([&]() {
+          tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                            [&](const tbb::blocked_range<size_t>& range) {
+                              function(range.begin(), range.end());
+                            });
+        });
+        return;
+      }
+#elif defined GTSAM_USE_THREAD_POOL
+      if (pool_) {
+        pool_->parallelFor(0, n, function);
+        return;
+      }
+#endif
+    }
+    function(0, n);
+  }
+
+ private:
+#ifdef GTSAM_USE_TBB
+  std::shared_ptr<tbb::task_arena> arena_;  ///< null if serial
+#elif defined GTSAM_USE_THREAD_POOL
+  std::shared_ptr<ThreadPool> ownPool_;  ///< only if numThreads > 1
+  ThreadPool* pool_;                     ///< null if serial
+#endif
+};
+
 /* ************************************************************************* */
 struct GTSAM_EXPORT DeltaImpl {
   struct GTSAM_EXPORT PartialSolveResult {
@@ -82,12 +144,15 @@ struct GTSAM_EXPORT DeltaImpl {
   };
 
   /**
-   * Update the Newton's method step point, using wildfire
+   * Update the Newton's method step point, using wildfire. If the executor is
+   * parallel, the Bayes tree is back-substituted level by level, with the
+   * cliques of each level in parallel.
    */
   static size_t UpdateGaussNewtonDelta(const ISAM2::Roots& roots,
                                        const KeySet& replacedKeys,
                                        double wildfireThreshold,
-                                       VectorValues* delta);
+                                       VectorValues* delta,
+                                       const ISAM2Executor& executor);
 
   /**
    * Update the RgProd (R*g) incrementally taking into account which variables
@@ -247,6 +312,25 @@ struct GTSAM_EXPORT UpdateImpl {
     }
   }
 
+  // The relinearization threshold vector for the type of variable key, of
+  // dimension dim
+  static const Vector& RelinearizationThreshold(
+      const FastMap<char, Vector>& thresholds, Key key, DenseIndex dim) {
+    const char chr = Symbol(key).chr();
+    FastMap<char, Vector>::const_iterator threshold = thresholds.find(chr);
+    if (threshold == thresholds.end())
+      throw std::invalid_argument(
+          "No relinearization threshold vector for '" + std::string(1, chr) +
+          "' was passed into iSAM2 parameters.");
+    if (threshold->second.rows() != dim)
+      throw std::invalid_argument(
+          "Relinearization threshold vector dimensionality for '" +
+          std::string(1, chr) +
+          "' passed into iSAM2 parameters does not match actual variable "
+          "dimensionality.");
+    return threshold->second;
+  }
+
   static void CheckRelinearizationRecursiveMap(
       const FastMap<char, Vector>& thresholds, const VectorValues& delta,
       const ISAM2::sharedClique& clique, KeySet* relinKeys) {
@@ -254,17 +338,9 @@ struct GTSAM_EXPORT UpdateImpl {
     bool relinearize = false;
     for (Key var : *clique->conditional()) {
       // Find the threshold for this variable type
-      const Vector& threshold = thresholds.find(Symbol(var).chr())->second;
-
       const Vector& deltaVar = delta[var];
-
-      // Verify the threshold vector matches the actual variable size
-      if (threshold.rows() != deltaVar.rows())
-        throw std::invalid_argument(
-            "Relinearization threshold vector dimensionality for '" +
-            std::string(1, Symbol(var).chr()) +
-            "' passed into iSAM2 parameters does not match actual variable "
-            "dimensionality.");
+      const Vector& threshold =
+          RelinearizationThreshold(thresholds, var, deltaVar.rows());
 
       // Check for relinearization
       if ((deltaVar.array().abs() > threshold.array()).any()) {
@@ -355,14 +431,8 @@ struct GTSAM_EXPORT UpdateImpl {
     } else if (const FastMap<char, Vector>* thresholds =
                    boost::get<FastMap<char, Vector> >(&relinearizeThreshold)) {
       for (const VectorValues::KeyValuePair& key_delta : delta) {
-        const Vector& threshold =
-            thresholds->find(Symbol(key_delta.first).chr())->second;
-        if (threshold.rows() != key_delta.second.rows())
-          throw std::invalid_argument(
-              "Relinearization threshold vector dimensionality for '" +
-              std::string(1, Symbol(key_delta.first).chr()) +
-              "' passed into iSAM2 parameters does not match actual variable "
-              "dimensionality.");
+        const Vector& threshold = RelinearizationThreshold(
+            *thresholds, key_delta.first, key_delta.second.rows());
         if ((key_delta.second.array().abs() > threshold.array()).any())
           relinKeys.insert(key_delta.first);
       }
@@ -401,6 +471,77 @@ struct GTSAM_EXPORT UpdateImpl {
     return relinKeys;
   }
 
+  // Priority of relinearizing a variable: the largest ratio of its delta to
+  // the relinearization threshold.
+  static double RelinearizationPriority(
+      Key key, const Vector& delta,
+      const ISAM2Params::RelinearizationThreshold& relinearizeThreshold) {
+    if (const double* threshold = boost::get<double>(&relinearizeThreshold)) {
+      const double maxDelta = delta.lpNorm<Eigen::Infinity>();
+      return *threshold > 0 ? maxDelta / *threshold : maxDelta;
+    }
+    const Vector& threshold = RelinearizationThreshold(
+        boost::get<FastMap<char, Vector> >(relinearizeThreshold), key,
+        delta.rows());
+    return (delta.array().abs() / threshold.array()).maxCoeff();
+  }
+
+  // Keep in relinKeys the variables with the largest deltas whose
+  // reelimination is predicted to fit in a budget, counted in variables, and
+  // return the others, removing them from markedKeys as well unless they are
+  // among the involvedKeys of new or removed factors.  A variable costs the
+  // frontal variables not marked yet in the cliques on its path to the root,
+  // starting with those of the involved keys that are not candidates.
+  KeySet deferRelinearizeKeys(const ISAM2::Nodes& nodes,
+                              const VectorValues& delta, double budget,
+                              const KeySet& involvedKeys, KeySet* relinKeys,
+                              KeySet* markedKeys) const {
+    gttic(deferRelinearizeKeys);
+    std::unordered_set<const ISAM2Clique*> visited;
+
+    // Cost of the unmarked cliques from that of key up to the root; once a
+    // clique is visited, so are all of its ancestors.
+    auto pathCost = [&](Key key, bool mark) {
+      auto node = nodes.find(key);
+      if (node == nodes.end()) return size_t(1);  // new variable
+      size_t cost = 0;
+      for (ISAM2::sharedClique clique = node->second;
+           clique && !visited.count(clique.get()); clique = clique->parent()) {
+        cost += clique->conditional()->nrFrontals();
+        if (mark) visited.insert(clique.get());
+      }
+      return cost;
+    };
+
+    double cost = 0.0;
+    for (Key key : involvedKeys)
+      if (!relinKeys->exists(key)) cost += pathCost(key, true);
+
+    std::vector<std::pair<double, Key> > candidates;
+    candidates.reserve(relinKeys->size());
+    for (Key key : *relinKeys)
+      candidates.emplace_back(
+          RelinearizationPriority(key, delta[key], params_.relinearizeThreshold),
+          key);
+    std::sort(candidates.begin(), candidates.end(),
+              std::greater<std::pair<double, Key> >());
+
+    KeySet deferred;
+    for (const auto& candidate : candidates) {
+      const size_t added = pathCost(candidate.second, false);
+      if (added == 0 || cost + added <= budget) {
+        cost += pathCost(candidate.second, true);
+      } else {
+        deferred.insert(candidate.second);
+      }
+    }
+    for (Key key : deferred) {
+      relinKeys->erase(key);
+      if (!involvedKeys.exists(key)) markedKeys->erase(key);
+    }
+    return deferred;
+  }
+
   // Record relinerization threshold keys in detailed results
   void recordRelinearizeDetail(const KeySet& relinKeys,
                                ISAM2Result::DetailedResults* detail) const {
@@ -26,6 +26,7 @@
 #include <gtsam/nonlinear/LinearContainerFactor.h>
 
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <utility>
 
@@ -37,19 +38,33 @@ namespace gtsam {
 template class BayesTree<ISAM2Clique>;
 
 /* ************************************************************************* */
-ISAM2::ISAM2(const ISAM2Params& params) : params_(params), update_count_(0) {
+ISAM2::ISAM2(const ISAM2Params& params)
+    : params_(params),
+      update_count_(0),
+      secondsPerVariable_(0.0),
+      relinearizationDeferred_(false),
+      executor_(boost::make_shared<ISAM2Executor>(params.numThreads)) {
   if (params_.optimizationParams.type() == typeid(ISAM2DoglegParams))
     doglegDelta_ =
         boost::get<ISAM2DoglegParams>(params_.optimizationParams).initialDelta;
 }
 
 /* ************************************************************************* */
-ISAM2::ISAM2() : update_count_(0) {
+ISAM2::ISAM2()
+    : update_count_(0),
+      secondsPerVariable_(0.0),
+      relinearizationDeferred_(false),
+      executor_(boost::make_shared<ISAM2Executor>(params_.numThreads)) {
   if (params_.optimizationParams.type() == typeid(ISAM2DoglegParams))
     doglegDelta_ =
         boost::get<ISAM2DoglegParams>(params_.optimizationParams).initialDelta;
 }
 
+/* ************************************************************************* */
+void ISAM2::resetExecutor() {
+  executor_ = boost::make_shared<ISAM2Executor>(params_.numThreads);
+}
+
 /* ************************************************************************* */
 bool ISAM2::equals(const ISAM2& other, double tol) const {
   return Base::equals(other, tol) && theta_.equals(other.theta_, tol) &&
@@ -73,7 +88,11 @@ GaussianFactorGraph ISAM2::relinearizeAffectedFactors(
   gttoc(affectedKeysSet);
 
   gttic(check_candidates_and_linearize);
+  // Collect the factors inside the affected area, re-using cached linear
+  // factors where possible, and leave slots for the ones to be re-linearized
   GaussianFactorGraph linearized;
+  FactorIndices toLinearize;
+  std::vector<size_t> slots;
   for (const FactorIndex idx : candidates) {
     bool inside = true;
     bool useCachedLinear = params_.cacheLinearizedFactors;
@@ -93,17 +112,27 @@ GaussianFactorGraph ISAM2::relinearizeAffectedFactors(
 #endif
         linearized.push_back(linearFactors_[idx]);
       } else {
-        auto linearFactor = nonlinearFactors_[idx]->linearize(theta_);
-        linearized.push_back(linearFactor);
-        if (params_.cacheLinearizedFactors) {
+        toLinearize.push_back(idx);
+        slots.push_back(linearized.size());
+        linearized.push_back(GaussianFactor::shared_ptr());
+      }
+    }
+  }
+
+  // Linearize, in parallel if enabled
+  executor_->parallelFor(toLinearize.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const FactorIndex idx = toLinearize[i];
+      auto linearFactor = nonlinearFactors_[idx]->linearize(theta_);
+      linearized[slots[i]] = linearFactor;
+      if (params_.cacheLinearizedFactors) {
 #ifdef GTSAM_EXTRA_CONSISTENCY_CHECKS
-          assert(linearFactors_[idx]->keys() == linearFactor->keys());
+        assert(linearFactors_[idx]->keys() == linearFactor->keys());
 #endif
-          linearFactors_[idx] = linearFactor;
-        }
+        linearFactors_[idx] = linearFactor;
       }
     }
-  }
+  });
   gttoc(check_candidates_and_linearize);
 
   return linearized;
@@ -415,14 +444,19 @@ ISAM2Result ISAM2::update(const NonlinearFactorGraph& newFactors,
                           const Values& newTheta,
                           const ISAM2UpdateParams& updateParams) {
   gttic(ISAM2_update);
+  typedef std::chrono::steady_clock Clock;
+  const Clock::time_point start = Clock::now();
   this->update_count_ += 1;
   UpdateImpl::LogStartingUpdate(newFactors, *this);
   ISAM2Result result(params_.enableDetailedResults);
   UpdateImpl update(params_, updateParams);
 
+  // Relinearizations deferred by a deadline are checked again right away
+  const bool relinearize =
+      update.relinarizationNeeded(update_count_) || relinearizationDeferred_;
+
   // Update delta if we need it to check relinearization later
-  if (update.relinarizationNeeded(update_count_))
-    updateDelta(updateParams.forceFullSolve);
+  if (relinearize) updateDelta(updateParams.forceFullSolve);
 
   // 1. Add any new factors \Factors:=\Factors\cup\Factors'.
   update.pushBackFactors(newFactors, &nonlinearFactors_, &linearFactors_,
@@ -444,10 +478,24 @@ ISAM2Result ISAM2::update(const NonlinearFactorGraph& newFactors,
 
   KeySet relinKeys;
   result.variablesRelinearized = 0;
-  if (update.relinarizationNeeded(update_count_)) {
+  result.variablesReeliminated = 0;
+  const Clock::time_point decided = Clock::now();
+  if (relinearize) {
     // 4. Mark keys in \Delta above threshold \beta:
+    const KeySet involvedKeys =
+        updateParams.deadline ? result.markedKeys : KeySet();
     relinKeys = update.gatherRelinearizeKeys(roots_, delta_, fixedVariables_,
                                              &result.markedKeys);
+    // Keep the largest deltas that fit in the time left, if any
+    if (updateParams.deadline && secondsPerVariable_ > 0.0) {
+      const double elapsed =
+          std::chrono::duration<double>(decided - start).count();
+      const double budget =
+          (*updateParams.deadline - elapsed) / secondsPerVariable_;
+      result.deferredRelinKeys = update.deferRelinearizeKeys(
+          nodes_, delta_, budget, involvedKeys, &relinKeys, &result.markedKeys);
+    }
+    relinearizationDeferred_ = !result.deferredRelinKeys.empty();
     update.recordRelinearizeDetail(relinKeys, result.details());
     if (!relinKeys.empty()) {
       // 5. Mark cliques that involve marked variables \Theta_{J} and ancestors.
@@ -470,6 +518,16 @@ ISAM2Result ISAM2::update(const NonlinearFactorGraph& newFactors,
   if (!result.unusedKeys.empty()) removeVariables(result.unusedKeys);
   result.cliques = this->nodes().size();
 
+  // Measure the time per reeliminated variable, to predict deadlines
+  if (result.variablesReeliminated > 0) {
+    const double seconds =
+        std::chrono::duration<double>(Clock::now() - decided).count() /
+        result.variablesReeliminated;
+    secondsPerVariable_ = secondsPerVariable_ > 0.0
+                              ? 0.75 * secondsPerVariable_ + 0.25 * seconds
+                              : seconds;
+  }
+
   if (params_.evaluateNonlinearError)
     update.error(nonlinearFactors_, calculateEstimate(), &result.errorAfter);
   return result;
@@ -640,6 +698,7 @@ void ISAM2::marginalizeLeaves(
         originalKeys.swap(cg->keys());
         cg->keys().assign(originalKeys.begin() + nToRemove, originalKeys.end());
         cg->nrFrontals() -= nToRemove;
+        clique->deleteCachedCovariance();
 
         // Add to factorIndicesToRemove any factors involved in frontals of
         // current clique
@@ -708,7 +767,8 @@ void ISAM2::updateDelta(bool forceFullSolve) const {
         forceFullSolve ? 0.0 : gaussNewtonParams.wildfireThreshold;
     gttic(Wildfire_update);
     DeltaImpl::UpdateGaussNewtonDelta(roots_, deltaReplacedMask_,
-                                      effectiveWildfireThreshold, &delta_);
+                                      effectiveWildfireThreshold, &delta_,
+                                      *executor_);
     deltaReplacedMask_.clear();
     gttoc(Wildfire_update);
 
@@ -724,8 +784,9 @@ void ISAM2::updateDelta(bool forceFullSolve) const {
 
     // Compute Newton's method step
     gttic(Wildfire_update);
-    DeltaImpl::UpdateGaussNewtonDelta(
-        roots_, deltaReplacedMask_, effectiveWildfireThreshold, &deltaNewton_);
+    DeltaImpl::UpdateGaussNewtonDelta(roots_, deltaReplacedMask_,
+                                      effectiveWildfireThreshold,
+                                      &deltaNewton_, *executor_);
     gttoc(Wildfire_update);
 
     // Compute steepest descent step
@@ -782,9 +843,7 @@ Values ISAM2::calculateBestEstimate() const {
 
 /* ************************************************************************* */
 Matrix ISAM2::marginalCovariance(Key key) const {
-  return marginalFactor(key, params_.getEliminationFunction())
-      ->information()
-      .inverse();
+  return nodes_.at(key)->covariance()->block(key, key);
 }
 
 /* ************************************************************************* */
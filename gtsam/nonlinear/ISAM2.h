@@ -27,10 +27,14 @@
 #include <gtsam/nonlinear/ISAM2UpdateParams.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 
+#include <boost/serialization/optional.hpp>
+
 #include <vector>
 
 namespace gtsam {
 
+class ISAM2Executor;
+
 /**
  * @addtogroup ISAM2
  * Implementation of the full ISAM2 algorithm for incremental nonlinear
@@ -96,6 +100,17 @@ class GTSAM_EXPORT ISAM2 : public BayesTree<ISAM2Clique> {
   int update_count_;  ///< Counter incremented every update(), used to determine
                       ///< periodic relinearization
 
+  /** Running average of the time update() takes per reeliminated variable, in
+   * seconds, used to meet ISAM2UpdateParams::deadline (0 until measured) */
+  double secondsPerVariable_;
+
+  /** Whether the last update deferred relinearizations, which forces the
+   * relinearization check in the next update */
+  bool relinearizationDeferred_;
+
+  /** Runs the parallel parts of update(), see ISAM2Params::numThreads */
+  boost::shared_ptr<ISAM2Executor> executor_;
+
  public:
   using This = ISAM2;                       ///< This class
   using Base = BayesTree<ISAM2Clique>;      ///< The BayesTree base class
@@ -236,7 +251,12 @@ class GTSAM_EXPORT ISAM2 : public BayesTree<ISAM2Clique> {
    */
   const Value& calculateEstimate(Key key) const;
 
-  /** Return marginal on any variable as a covariance matrix */
+  /**
+   * Return marginal on any variable as a covariance matrix.  The joint
+   * covariances of the cliques from the root to the clique of \c key are
+   * cached, see ISAM2Clique::covariance, such that repeated queries, e.g. for
+   * the latest pose after every update, only recompute re-eliminated cliques.
+   */
   Matrix marginalCovariance(Key key) const;
 
   /// @name Public members for non-typical usage
@@ -315,6 +335,38 @@ class GTSAM_EXPORT ISAM2 : public BayesTree<ISAM2Clique> {
   void removeVariables(const KeySet& unusedKeys);
 
   void updateDelta(bool forceFullSolve = false) const;
+
+  /// Create the executor for params_.numThreads
+  void resetExecutor();
+
+ private:
+  /** Serialization function, e.g., with serializeBinary, to checkpoint the
+   * complete state: the Bayes tree with the cached factors of its cliques,
+   * theta, delta, the variable index, the nonlinear and linear factors and
+   * the parameters (except the keyFormatter).  A restored instance continues
+   * exactly where the saved one left off, without replaying any updates.
+   * As for NonlinearFactorGraph, the factor and value types used have to be
+   * exported, see GTSAM_VALUE_EXPORT and BOOST_CLASS_EXPORT. */
+  friend class boost::serialization::access;
+  template <class ARCHIVE>
+  void serialize(ARCHIVE& ar, const unsigned int /*version*/) {
+    ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Base);
+    ar& BOOST_SERIALIZATION_NVP(theta_);
+    ar& BOOST_SERIALIZATION_NVP(variableIndex_);
+    ar& BOOST_SERIALIZATION_NVP(delta_);
+    ar& BOOST_SERIALIZATION_NVP(deltaNewton_);
+    ar& BOOST_SERIALIZATION_NVP(RgProd_);
+    ar& BOOST_SERIALIZATION_NVP(deltaReplacedMask_);
+    ar& BOOST_SERIALIZATION_NVP(nonlinearFactors_);
+    ar& BOOST_SERIALIZATION_NVP(linearFactors_);
+    ar& BOOST_SERIALIZATION_NVP(params_);
+    ar& BOOST_SERIALIZATION_NVP(doglegDelta_);
+    ar& BOOST_SERIALIZATION_NVP(fixedVariables_);
+    ar& BOOST_SERIALIZATION_NVP(update_count_);
+    ar& BOOST_SERIALIZATION_NVP(secondsPerVariable_);
+    ar& BOOST_SERIALIZATION_NVP(relinearizationDeferred_);
+    if (ARCHIVE::is_loading::value) resetExecutor();
+  }
 };  // ISAM2
 
 /// traits
@@ -20,8 +20,11 @@
 #include <gtsam/linear/linearAlgorithms-inst.h>
 #include <gtsam/nonlinear/ISAM2Clique.h>
 
+#include <boost/make_shared.hpp>
+
 #include <stack>
 #include <utility>
+#include <vector>
 
 using namespace std;
 
@@ -42,6 +45,27 @@ void ISAM2Clique::setEliminationResult(
   gradientContribution_ << -conditional_->R().transpose() *
                                conditional_->d(),
       -conditional_->S().transpose() * conditional_->d();
+  deleteCachedCovariance();
+}
+
+/* ************************************************************************* */
+CliqueCovariance::shared_ptr ISAM2Clique::covariance() const {
+  // The path from the root to this clique, iteratively as trees can be deep
+  vector<const ISAM2Clique*> path(1, this);
+  while (!path.back()->isRoot()) path.push_back(path.back()->parent().get());
+
+  // Recompute top-down where the cached covariance is missing or stale
+  CliqueCovariance::shared_ptr parentCovariance;
+  for (auto clique = path.rbegin(); clique != path.rend(); ++clique) {
+    const ISAM2Clique& c = **clique;
+    if (!c.cachedCovariance_ || c.cachedParentCovariance_ != parentCovariance) {
+      c.cachedCovariance_ = boost::make_shared<CliqueCovariance>(
+          *c.conditional_, parentCovariance.get());
+      c.cachedParentCovariance_ = parentCovariance;
+    }
+    parentCovariance = c.cachedCovariance_;
+  }
+  return cachedCovariance_;
 }
 
 /* ************************************************************************* */
@@ -208,7 +232,7 @@ void ISAM2Clique::optimizeWildfire(const KeySet& replaced, double threshold,
 
     // Back-substitute
     fastBackSubstitute(delta);
-    count += conditional_->nrFrontals();
+    *count += conditional_->nrFrontals();
 
     if (valuesChanged(replaced, originalValues, *delta, threshold)) {
       markFrontalsAsChanged(changed);
@@ -236,19 +260,32 @@ size_t optimizeWildfire(const ISAM2Clique::shared_ptr& root, double threshold,
 bool ISAM2Clique::optimizeWildfireNode(const KeySet& replaced, double threshold,
                                        KeySet* changed, VectorValues* delta,
                                        size_t* count) const {
+  bool frontalsChanged = false;
+  bool dirty =
+      optimizeWildfireNode(replaced, threshold, *changed, delta, &frontalsChanged);
+  if (dirty) *count += conditional_->nrFrontals();
+  if (frontalsChanged) markFrontalsAsChanged(changed);
+  return dirty;
+}
+
+/* ************************************************************************* */
+bool ISAM2Clique::optimizeWildfireNode(const KeySet& replaced, double threshold,
+                                       const KeySet& changed,
+                                       VectorValues* delta,
+                                       bool* frontalsChanged) const {
   // TODO(gareth): This code shares a lot of logic w/ linearAlgorithms-inst,
   // potentially refactor
-  bool dirty = isDirty(replaced, *changed);
+  *frontalsChanged = false;
+  bool dirty = isDirty(replaced, changed);
   if (dirty) {
     // Temporary copy of the original values, to check how much they change
     auto originalValues = delta->vector(conditional_->frontals());
 
     // Back-substitute
     fastBackSubstitute(delta);
-    count += conditional_->nrFrontals();
 
     if (valuesChanged(replaced, originalValues, *delta, threshold)) {
-      markFrontalsAsChanged(changed);
+      *frontalsChanged = true;
     } else {
       restoreFromOriginals(originalValues, delta);
     }
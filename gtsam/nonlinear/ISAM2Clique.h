@@ -24,6 +24,7 @@
 #include <gtsam/linear/GaussianBayesNet.h>
 #include <gtsam/linear/GaussianConditional.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/SparseInverse.h>
 #include <string>
 
 namespace gtsam {
@@ -48,6 +49,10 @@ class GTSAM_EXPORT ISAM2Clique
 #ifdef USE_BROKEN_FAST_BACKSUBSTITUTE
   mutable FastMap<Key, VectorValues::iterator> solnPointers_;
 #endif
+  /// Joint covariance of the clique variables, see covariance()
+  mutable CliqueCovariance::shared_ptr cachedCovariance_;
+  /// The covariance of the parent that cachedCovariance_ was computed from
+  mutable CliqueCovariance::shared_ptr cachedParentCovariance_;
 
   /// Default constructor
   ISAM2Clique() : Base() {}
@@ -57,7 +62,9 @@ class GTSAM_EXPORT ISAM2Clique
   ISAM2Clique(const ISAM2Clique& other)
       : Base(other),
         cachedFactor_(other.cachedFactor_),
-        gradientContribution_(other.gradientContribution_) {}
+        gradientContribution_(other.gradientContribution_),
+        cachedCovariance_(other.cachedCovariance_),
+        cachedParentCovariance_(other.cachedParentCovariance_) {}
 
   /// Assignment operator, does *not* copy solution pointers as these are
   /// invalid in different trees.
@@ -65,6 +72,8 @@ class GTSAM_EXPORT ISAM2Clique
     Base::operator=(other);
     cachedFactor_ = other.cachedFactor_;
     gradientContribution_ = other.gradientContribution_;
+    cachedCovariance_ = other.cachedCovariance_;
+    cachedParentCovariance_ = other.cachedParentCovariance_;
     return *this;
   }
 
@@ -78,6 +87,22 @@ class GTSAM_EXPORT ISAM2Clique
   /// Access the gradient contribution
   const Vector& gradientContribution() const { return gradientContribution_; }
 
+  /**
+   * The joint covariance of the frontal and separator variables.  It is
+   * computed from the covariance of the parent, see CliqueCovariance, and
+   * cached.  A cached covariance stays valid as long as the one of the parent
+   * it was computed from does, so after an update only the cliques that were
+   * re-eliminated, and the subtrees below them, are recomputed, and only
+   * when queried.  Like the cached shortcuts, the cache is not thread-safe.
+   */
+  CliqueCovariance::shared_ptr covariance() const;
+
+  /// Discard the cached covariance, e.g. when the conditional changed in place
+  void deleteCachedCovariance() const {
+    cachedCovariance_.reset();
+    cachedParentCovariance_.reset();
+  }
+
   /// Recursively add gradient at zero to g
   void addGradientAtZero(VectorValues* g) const;
 
@@ -95,6 +120,17 @@ class GTSAM_EXPORT ISAM2Clique
                             KeySet* changed, VectorValues* delta,
                             size_t* count) const;
 
+  /**
+   * Back-substitute this clique if it is dirty, like the version above, but
+   * without modifying \c changed. Instead, \c frontalsChanged is set if the
+   * frontal values changed above the threshold, so that cliques can be solved
+   * in parallel and their changes recorded afterwards.
+   * @return whether the clique was dirty, i.e., was back-substituted
+   */
+  bool optimizeWildfireNode(const KeySet& replaced, double threshold,
+                            const KeySet& changed, VectorValues* delta,
+                            bool* frontalsChanged) const;
+
   /**
    * Starting from the root, add up entries of frontal and conditional matrices
    * of each conditional
@@ -21,6 +21,8 @@
 
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/nonlinear/DoglegOptimizerImpl.h>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/variant.hpp>
 #include <boost/variant.hpp>
 #include <string>
 
@@ -56,6 +58,14 @@ struct GTSAM_EXPORT ISAM2GaussNewtonParams {
   void setWildfireThreshold(double wildfireThreshold) {
     this->wildfireThreshold = wildfireThreshold;
   }
+
+ private:
+  /** Serialization function */
+  friend class boost::serialization::access;
+  template <class ARCHIVE>
+  void serialize(ARCHIVE& ar, const unsigned int /*version*/) {
+    ar& BOOST_SERIALIZATION_NVP(wildfireThreshold);
+  }
 };
 
 /**
@@ -123,6 +133,17 @@ struct GTSAM_EXPORT ISAM2DoglegParams {
       const;
   DoglegOptimizerImpl::TrustRegionAdaptationMode adaptationModeTranslator(
       const std::string& adaptationMode) const;
+
+ private:
+  /** Serialization function */
+  friend class boost::serialization::access;
+  template <class ARCHIVE>
+  void serialize(ARCHIVE& ar, const unsigned int /*version*/) {
+    ar& BOOST_SERIALIZATION_NVP(initialDelta);
+    ar& BOOST_SERIALIZATION_NVP(wildfireThreshold);
+    ar& BOOST_SERIALIZATION_NVP(adaptationMode);
+    ar& BOOST_SERIALIZATION_NVP(verbose);
+  }
 };
 
 /**
@@ -223,6 +244,16 @@ struct GTSAM_EXPORT ISAM2Params {
   /// cost of having to search for slots every time a factor is added.
   bool findUnusedFactorSlots;
 
+  /** The number of threads used to linearize affected factors and for the
+   * wildfire back-substitution in ISAM2::update (default: -1). With -1 or 1
+   * these steps run serially in the calling thread, as before this option
+   * existed, with 0 TBB or the global ThreadPool decide, and with N > 1 at
+   * most N threads are used. Without TBB or the thread pool, everything runs
+   * serially. The elimination itself always uses the TBB default or the
+   * global ThreadPool.
+   */
+  int numThreads;
+
   /**
    * Specify parameters as constructor arguments
    * See the documentation of member variables above.
@@ -246,7 +277,8 @@ struct GTSAM_EXPORT ISAM2Params {
         keyFormatter(_keyFormatter),
         enableDetailedResults(_enableDetailedResults),
         enablePartialRelinearizationCheck(false),
-        findUnusedFactorSlots(false) {}
+        findUnusedFactorSlots(false),
+        numThreads(-1) {}
 
   /// print iSAM2 parameters
   void print(const std::string& str = "") const {
@@ -288,6 +320,7 @@ struct GTSAM_EXPORT ISAM2Params {
          << enablePartialRelinearizationCheck << "\n";
     cout << "findUnusedFactorSlots:             " << findUnusedFactorSlots
          << "\n";
+    cout << "numThreads:                        " << numThreads << "\n";
     cout.flush();
   }
 
@@ -312,6 +345,7 @@ struct GTSAM_EXPORT ISAM2Params {
   bool isEnablePartialRelinearizationCheck() const {
     return enablePartialRelinearizationCheck;
   }
+  int getNumThreads() const { return numThreads; }
 
   void setOptimizationParams(OptimizationParams optimizationParams) {
     this->optimizationParams = optimizationParams;
@@ -344,6 +378,7 @@ struct GTSAM_EXPORT ISAM2Params {
       bool enablePartialRelinearizationCheck) {
     this->enablePartialRelinearizationCheck = enablePartialRelinearizationCheck;
   }
+  void setNumThreads(int numThreads) { this->numThreads = numThreads; }
 
   GaussianFactorGraph::Eliminate getEliminationFunction() const {
     return factorization == CHOLESKY
@@ -360,6 +395,24 @@ struct GTSAM_EXPORT ISAM2Params {
   static std::string factorizationTranslator(const Factorization& value);
 
   /// @}
+
+ private:
+  /** Serialization function, the keyFormatter is not saved */
+  friend class boost::serialization::access;
+  template <class ARCHIVE>
+  void serialize(ARCHIVE& ar, const unsigned int /*version*/) {
+    ar& BOOST_SERIALIZATION_NVP(optimizationParams);
+    ar& BOOST_SERIALIZATION_NVP(relinearizeThreshold);
+    ar& BOOST_SERIALIZATION_NVP(relinearizeSkip);
+    ar& BOOST_SERIALIZATION_NVP(enableRelinearization);
+    ar& BOOST_SERIALIZATION_NVP(evaluateNonlinearError);
+    ar& BOOST_SERIALIZATION_NVP(factorization);
+    ar& BOOST_SERIALIZATION_NVP(cacheLinearizedFactors);
+    ar& BOOST_SERIALIZATION_NVP(enableDetailedResults);
+    ar& BOOST_SERIALIZATION_NVP(enablePartialRelinearizationCheck);
+    ar& BOOST_SERIALIZATION_NVP(findUnusedFactorSlots);
+    ar& BOOST_SERIALIZATION_NVP(numThreads);
+  }
 };
 
 }  // namespace gtsam
@@ -110,6 +110,11 @@ struct ISAM2Result {
   /** All keys that were marked during the update process. */
   KeySet markedKeys;
 
+  /** Variables above the relinearization threshold that were not
+   * relinearized, to meet ISAM2UpdateParams::deadline.  They are considered
+   * again, by decreasing delta, in the next update. */
+  KeySet deferredRelinKeys;
+
   /**
    * A struct holding detailed results, which must be enabled with
    * ISAM2Params::enableDetailedResults.
@@ -176,6 +181,7 @@ struct ISAM2Result {
   size_t getVariablesRelinearized() const { return variablesRelinearized; }
   size_t getVariablesReeliminated() const { return variablesReeliminated; }
   size_t getCliques() const { return cliques; }
+  const KeySet& getDeferredRelinKeys() const { return deferredRelinKeys; }
 };
 
 }  // namespace gtsam
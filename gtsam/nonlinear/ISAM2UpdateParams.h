@@ -69,6 +69,15 @@ struct ISAM2UpdateParams {
    * the deltas become too small down in the tree. This flagg forces a full
    * solve instead. */
   bool forceFullSolve{false};
+
+  /** An optional time budget for this update, in seconds. When relinearizing,
+   * iSAM2 then predicts how many variables it can reeliminate within the
+   * budget, from the time per variable measured in previous updates, and
+   * relinearizes the variables with the largest deltas first. Variables that
+   * do not fit are deferred to the next update and reported in
+   * ISAM2Result::deferredRelinKeys. New factors are always added in full, so
+   * the budget may still be exceeded by large loop closures. */
+  boost::optional<double> deadline{boost::none};
 };
 
 }  // namespace gtsam
@@ -80,11 +80,6 @@ int LevenbergMarquardtOptimizer::getInnerIterations() const {
   return currentState->totalNumberInnerIterations;
 }
 
-/* ************************************************************************* */
-GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::linearize() const {
-  return graph_.linearize(state_->values);
-}
-
 /* ************************************************************************* */
 GaussianFactorGraph LevenbergMarquardtOptimizer::buildDampedSystem(
     const GaussianFactorGraph& linear, const VectorValues& sqrtHessianDiagonal) const {
@@ -100,6 +95,27 @@ GaussianFactorGraph LevenbergMarquardtOptimizer::buildDampedSystem(
     return currentState->buildDampedSystem(linear);
 }
 
+/* ************************************************************************* */
+VectorValues LevenbergMarquardtOptimizer::solveDampedInPlace(
+    const VectorValues& sqrtHessianDiagonal) const {
+  gttic(damp_in_place);
+  auto currentState = static_cast<const State*>(state_.get());
+
+  if (params_.verbosityLM >= LevenbergMarquardtParams::DAMPED)
+    std::cout << "damping assembled system with lambda " << currentState->lambda << std::endl;
+
+  if (params_.diagonalDamping) {
+    // The prior factors of buildDampedSystem add lambda * diag(hessian)
+    VectorValues diagonal = sqrtHessianDiagonal;
+    for (Vector& v : diagonal | map_values)
+      v = v.cwiseAbs2();
+    supernodal_->factorizeDamped(currentState->lambda, &diagonal);
+  } else {
+    supernodal_->factorizeDamped(currentState->lambda);
+  }
+  return supernodal_->solve();
+}
+
 /* ************************************************************************* */
 // Log current error/lambda to file
 inline void LevenbergMarquardtOptimizer::writeLogFile(double currentError){
@@ -133,7 +149,10 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
     cout << "trying lambda = " << currentState->lambda << endl;
 
   // Build damped system for this lambda (adds prior factors that make it like gradient descent)
-  auto dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
+  const bool dampInPlace = params_.inPlaceDamping && params_.isSupernodal();
+  GaussianFactorGraph dampedSystem;
+  if (!dampInPlace)
+    dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
 
   // Try solving
   double modelFidelity = 0.0;
@@ -146,7 +165,8 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   bool systemSolvedSuccessfully;
   try {
     // ============ Solve is where most computation happens !! =================
-    delta = solve(dampedSystem, params_);
+    delta = dampInPlace ? solveDampedInPlace(sqrtHessianDiagonal)
+                        : solve(dampedSystem, params_);
     systemSolvedSuccessfully = true;
   } catch (const IndeterminantLinearSystemException&) {
     systemSolvedSuccessfully = false;
@@ -284,6 +304,10 @@ GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::iterate() {
     }
   }
 
+  // With in-place damping, assemble the undamped system once for all lambdas
+  if (params_.inPlaceDamping && params_.isSupernodal())
+    supernodalFactorization(*linear, params_).assemble(*linear);
+
   // Keep increasing lambda until we make make progress
   while (!tryLambda(*linear, sqrtHessianDiagonal)) {
     auto newState = static_cast<const State*>(state_.get());
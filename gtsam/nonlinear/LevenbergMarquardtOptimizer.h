@@ -107,9 +107,6 @@ public:
 
   void writeLogFile(double currentError);
 
-  /** linearize, can be overwritten */
-  virtual GaussianFactorGraph::shared_ptr linearize() const;
-
   /** Build a damped system for a specific lambda -- for testing only */
   GaussianFactorGraph buildDampedSystem(const GaussianFactorGraph& linear,
                                         const VectorValues& sqrtHessianDiagonal) const;
@@ -117,6 +114,13 @@ public:
   /** Inner loop, changes state, returns true if successful or giving up */
   bool tryLambda(const GaussianFactorGraph& linear, const VectorValues& sqrtHessianDiagonal);
 
+  /**
+   * Solve the system assembled by iterate() for the current lambda, damping
+   * the diagonal of the assembled Hessian in place, see
+   * LevenbergMarquardtParams::inPlaceDamping.
+   */
+  VectorValues solveDampedInPlace(const VectorValues& sqrtHessianDiagonal) const;
+
   /// @}
 
 protected:
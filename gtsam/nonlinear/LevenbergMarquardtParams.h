@@ -54,12 +54,14 @@ public:
   bool useFixedLambdaFactor; ///< if true applies constant increase (or decrease) to lambda according to lambdaFactor
   double minDiagonal; ///< when using diagonal damping saturates the minimum diagonal entries (default: 1e-6)
   double maxDiagonal; ///< when using diagonal damping saturates the maximum diagonal entries (default: 1e32)
+  bool inPlaceDamping; ///< if true and linearSolverType is SUPERNODAL_CHOLESKY, lambda is added to the diagonal of the assembled Hessian, which is assembled once per iteration and re-factorized for every lambda, instead of solving a copy of the graph with prior factors (default: false)
 
   LevenbergMarquardtParams()
       : verbosityLM(SILENT),
         diagonalDamping(false),
         minDiagonal(1e-6),
-        maxDiagonal(1e32) {
+        maxDiagonal(1e32),
+        inPlaceDamping(false) {
     SetLegacyDefaults(this);
   }
 
@@ -125,6 +127,7 @@ public:
   /// @name Getters/Setters, mainly for wrappers. Use fields above in C++.
   /// @{
   bool getDiagonalDamping() const { return diagonalDamping; }
+  bool getInPlaceDamping() const { return inPlaceDamping; }
   double getlambdaFactor() const { return lambdaFactor; }
   double getlambdaInitial() const { return lambdaInitial; }
   double getlambdaLowerBound() const { return lambdaLowerBound; }
@@ -134,6 +137,7 @@ public:
   std::string getVerbosityLM() const { return verbosityLMTranslator(verbosityLM);}
   
   void setDiagonalDamping(bool flag) { diagonalDamping = flag; }
+  void setInPlaceDamping(bool flag) { inPlaceDamping = flag; }
   void setlambdaFactor(double value) { lambdaFactor = value; }
   void setlambdaInitial(double value) { lambdaInitial = value; }
   void setlambdaLowerBound(double value) { lambdaLowerBound = value; }
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    LinearizationCache.cpp
+ * @brief   Re-use linear factors across linearizations of the same graph
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/nonlinear/LinearizationCache.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/base/timing.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+namespace {
+
+// Express a linear factor, linearized at theta, in the tangent space at
+// theta.retract(delta). Returns an empty pointer if the factor type is unknown.
+GaussianFactor::shared_ptr shiftLinearFactor(
+    const GaussianFactor::shared_ptr& factor, const VectorValues& delta) {
+  if (auto jacobian = boost::dynamic_pointer_cast<JacobianFactor>(factor)) {
+    // A x - b = A (y + d) - b = A y - (b - A d)
+    auto shifted = boost::make_shared<JacobianFactor>(*jacobian);
+    for (auto it = shifted->begin(); it != shifted->end(); ++it)
+      shifted->getb() -= shifted->getA(it) * delta.at(*it);
+    return shifted;
+  } else if (auto hessian = boost::dynamic_pointer_cast<HessianFactor>(factor)) {
+    // x'Gx - 2x'g + f with x = y + d gives g <- g - Gd, f <- f + d'Gd - 2d'g
+    auto shifted = boost::make_shared<HessianFactor>(*hessian);
+    const Vector d = delta.vector(hessian->keys());
+    const Vector Gd = hessian->informationView() * d;
+    shifted->constantTerm() += d.dot(Gd) - 2.0 * d.dot(hessian->linearTerm().col(0));
+    shifted->linearTerm() -= Gd;
+    return shifted;
+  }
+  return GaussianFactor::shared_ptr();
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+GaussianFactorGraph::shared_ptr LinearizationCache::linearize(
+    const NonlinearFactorGraph& graph, const Values& values) {
+  gttic(LinearizationCache_linearize);
+
+  // If factors were removed from the end we cannot match them up anymore
+  const size_t n = graph.size();
+  if (factors_.size() > n) clear();
+  factors_.resize(n);
+  linearFactors_.resize(n);
+
+  // New variables are linearized at their current value, for all others
+  // compute how far they moved from their linearization point.
+  KeySet relinKeys;
+  VectorValues delta;
+  for (const auto& key_value : values) {
+    Values::iterator theta = theta_.find(key_value.key);
+    if (theta == theta_.end()) {
+      theta_.insert(key_value.key, key_value.value);
+      relinKeys.insert(key_value.key);
+      delta.insert(key_value.key, Vector::Zero(key_value.value.dim()));
+    } else {
+      delta.insert(key_value.key,
+                   (*theta).value.localCoordinates_(key_value.value));
+    }
+  }
+
+  // Move the linearization point of variables above the threshold
+  for (Key key : checkRelinearization(delta)) {
+    theta_.update(key, values.at(key));
+    delta.at(key).setZero();
+    relinKeys.insert(key);
+  }
+
+  auto linearFG = boost::make_shared<GaussianFactorGraph>();
+  linearFG->reserve(n);
+  lastRelinearized_ = 0;
+
+  for (size_t i = 0; i < n; ++i) {
+    const NonlinearFactor::shared_ptr& factor = graph[i];
+    if (!factor) {
+      factors_[i].reset();
+      linearFactors_[i].reset();
+      linearFG->push_back(GaussianFactor::shared_ptr());
+      continue;
+    }
+
+    // Check whether the factor is new or involves a relinearized variable
+    bool relinearize = (factor != factors_[i]) || !linearFactors_[i];
+    bool moved = false;
+    for (Key key : factor->keys()) {
+      if (relinKeys.exists(key)) relinearize = true;
+      VectorValues::const_iterator d = delta.find(key);
+      if (d != delta.end() && !d->second.isZero()) moved = true;
+    }
+
+    if (relinearize) {
+      factors_[i] = factor;
+      linearFactors_[i] = factor->linearize(theta_);
+      ++lastRelinearized_;
+    }
+
+    GaussianFactor::shared_ptr linearFactor = linearFactors_[i];
+    if (linearFactor && moved) {
+      linearFactor = shiftLinearFactor(linearFactor, delta);
+      // Unknown linear factor types are linearized at the requested values
+      if (!linearFactor) {
+        linearFactor = factor->linearize(values);
+        ++lastRelinearized_;
+      }
+    }
+    linearFG->push_back(linearFactor);
+  }
+
+  return linearFG;
+}
+
+/* ************************************************************************* */
+void LinearizationCache::clear() {
+  factors_ = NonlinearFactorGraph();
+  linearFactors_ = GaussianFactorGraph();
+  theta_.clear();
+  lastRelinearized_ = 0;
+}
+
+/* ************************************************************************* */
+KeySet LinearizationCache::checkRelinearization(const VectorValues& delta) const {
+  KeySet relinKeys;
+
+  if (const double* threshold = boost::get<double>(&threshold_)) {
+    for (const VectorValues::KeyValuePair& key_delta : delta) {
+      double maxDelta = key_delta.second.lpNorm<Eigen::Infinity>();
+      if (maxDelta >= *threshold) relinKeys.insert(key_delta.first);
+    }
+  } else if (const FastMap<char, Vector>* thresholds =
+                 boost::get<FastMap<char, Vector> >(&threshold_)) {
+    for (const VectorValues::KeyValuePair& key_delta : delta) {
+      const char chr = Symbol(key_delta.first).chr();
+      FastMap<char, Vector>::const_iterator threshold = thresholds->find(chr);
+      if (threshold == thresholds->end() ||
+          threshold->second.rows() != key_delta.second.rows())
+        throw std::invalid_argument(
+            "LinearizationCache: no relinearization threshold vector of the "
+            "right dimension was given for variables '" + string(1, chr) + "'.");
+      if ((key_delta.second.array().abs() > threshold->second.array()).any())
+        relinKeys.insert(key_delta.first);
+    }
+  }
+
+  return relinKeys;
+}
+
+}  // namespace gtsam
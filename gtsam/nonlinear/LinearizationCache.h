@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    LinearizationCache.h
+ * @brief   Re-use linear factors across linearizations of the same graph
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/base/FastMap.h>
+
+#include <boost/variant.hpp>
+
+namespace gtsam {
+
+/**
+ * Keeps the linear factors of a previous linearization of a NonlinearFactorGraph,
+ * and on the next call only re-linearizes factors that involve a variable whose
+ * linearization point moved beyond a threshold, as ISAM2 does with
+ * ISAM2Params::relinearizeThreshold.
+ *
+ * The cache keeps its own linearization point theta for every variable. Only the
+ * variables that moved further than the threshold from theta are updated in
+ * theta, and all factors involving them are re-linearized at theta. All other
+ * linear factors are re-used, and all linear factors are shifted to first order
+ * so that they are expressed in the tangent space of the requested values, i.e.,
+ * a JacobianFactor \f$ A x - b \f$ linearized at theta becomes
+ * \f$ A x - (b - A d) \f$ with \f$ d = \text{theta.localCoordinates(values)} \f$.
+ * Factors that linearize to anything else than a JacobianFactor or HessianFactor
+ * are always re-linearized.
+ *
+ * Typical use is through NonlinearOptimizerParams::relinearizeThreshold, which
+ * makes the batch optimizers keep a cache across iterations.
+ */
+class GTSAM_EXPORT LinearizationCache {
+ public:
+  /// Either a single threshold on the infinity norm of the change of any
+  /// variable, or a per-dimension threshold vector for each Symbol character.
+  typedef boost::variant<double, FastMap<char, Vector> > RelinearizationThreshold;
+
+ private:
+  RelinearizationThreshold threshold_;  ///< Relinearization threshold
+  NonlinearFactorGraph factors_;  ///< Factors corresponding to linearFactors_
+  GaussianFactorGraph linearFactors_;  ///< Linear factors, linearized at theta_
+  Values theta_;  ///< The linearization point of each variable
+  size_t lastRelinearized_;  ///< Number of factors re-linearized in last call
+
+ public:
+  /// Construct an empty cache with the given threshold
+  explicit LinearizationCache(const RelinearizationThreshold& threshold = 0.1)
+      : threshold_(threshold), lastRelinearized_(0) {}
+
+  /**
+   * Linearize graph, only re-linearizing factors that were added or replaced since
+   * the last call, or that involve a variable that moved beyond the threshold.
+   * @param graph The nonlinear factor graph, which can grow between calls
+   * @param values The values at which the linear factors should be expressed
+   */
+  GaussianFactorGraph::shared_ptr linearize(const NonlinearFactorGraph& graph,
+                                            const Values& values);
+
+  /// Forget all cached linear factors, the next call re-linearizes everything
+  void clear();
+
+  /// The relinearization threshold
+  const RelinearizationThreshold& threshold() const { return threshold_; }
+
+  /// The linearization point of the cached linear factors
+  const Values& linearizationPoint() const { return theta_; }
+
+  /// Number of factors that were re-linearized in the last call to linearize
+  size_t lastRelinearized() const { return lastRelinearized_; }
+
+ private:
+  /// Check which variables in delta exceed the threshold
+  KeySet checkRelinearization(const VectorValues& delta) const;
+};
+
+}  // namespace gtsam
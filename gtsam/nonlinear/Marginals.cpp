@@ -19,6 +19,7 @@
 #include <gtsam/base/timing.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/SparseInverse.h>
 #include <gtsam/nonlinear/Marginals.h>
 
 using namespace std;
@@ -130,6 +131,16 @@ Matrix Marginals::marginalCovariance(Key variable) const {
   return marginalInformation(variable).inverse();
 }
 
+/* ************************************************************************* */
+FastMap<Key, Matrix> Marginals::marginalCovariances(
+    const KeyVector& variables) const {
+  const SparseInverse sparseInverse(bayesTree_, variables);
+  FastMap<Key, Matrix> covariances;
+  for (Key key : variables)
+    covariances.emplace(key, sparseInverse.marginalCovariance(key));
+  return covariances;
+}
+
 /* ************************************************************************* */
 JointMarginal Marginals::jointMarginalCovariance(const KeyVector& variables) const {
   JointMarginal info = jointMarginalInformation(variables);
@@ -113,6 +113,11 @@ public:
   /** Compute the marginal covariance of a single variable */
   Matrix marginalCovariance(Key variable) const;
 
+  /** Compute the marginal covariances of many variables in one pass over the
+   * Bayes tree, in parallel across subtrees, see SparseInverse.  Much faster
+   * than calling marginalCovariance for every variable. */
+  FastMap<Key, Matrix> marginalCovariances(const KeyVector& variables) const;
+
   /** Compute the joint marginal covariance of several variables */
   JointMarginal jointMarginalCovariance(const KeyVector& variables) const;
 
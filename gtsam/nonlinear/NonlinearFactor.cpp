@@ -17,6 +17,7 @@
  */
 
 #include <gtsam/nonlinear/NonlinearFactor.h>
+#include <gtsam/base/Arena.h>
 #include <boost/make_shared.hpp>
 #include <boost/format.hpp>
 
@@ -156,11 +157,16 @@ boost::shared_ptr<GaussianFactor> NoiseModelFactor::linearize(
   // TODO pass unwhitened + noise model to Gaussian factor
   using noiseModel::Constrained;
   if (noiseModel_ && noiseModel_->isConstrained())
-    return GaussianFactor::shared_ptr(
-        new JacobianFactor(terms, b,
-            boost::static_pointer_cast<Constrained>(noiseModel_)->unit()));
+    return allocateShared<JacobianFactor>(terms, b,
+        SharedDiagonal(boost::static_pointer_cast<Constrained>(noiseModel_)->unit()));
   else
-    return GaussianFactor::shared_ptr(new JacobianFactor(terms, b));
+    return allocateShared<JacobianFactor>(terms, b);
+}
+
+/* ************************************************************************* */
+std::vector<Matrix>& NoiseModelFactor::JacobianBuffers() {
+  static thread_local std::vector<Matrix> buffers;
+  return buffers;
 }
 
 /* ************************************************************************* */
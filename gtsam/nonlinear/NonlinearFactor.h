@@ -23,12 +23,16 @@
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/FixedJacobianFactor.h>
 #include <gtsam/inference/Factor.h>
 #include <gtsam/base/OptionalJacobian.h>
+#include <gtsam/base/Arena.h>
 
 #include <boost/serialization/base_object.hpp>
 #include <boost/assign/list_of.hpp>
 
+#include <type_traits>
+
 #ifdef GTSAM_ALLOW_DEPRECATED_SINCE_V4
 #define ADD_CLONE_NONLINEAR_FACTOR(Derived) \
   virtual gtsam::NonlinearFactor::shared_ptr clone() const { \
@@ -258,8 +262,67 @@ public:
   /// @}
 #endif
 
+protected:
+
+  /**
+   * Linearize into a FixedJacobianFactor<M, DIMS...>, for derived classes
+   * whose error dimension M and variable dimensions DIMS are known at compile
+   * time, see NoiseModelFactor1::linearizeFixed.  The Jacobians are computed
+   * into per-thread matrices of the right size, which evaluateError does not
+   * reallocate, and [A b] is assembled and whitened in a fixed-size matrix.
+   * Robust, full Gaussian and constrained noise models, and dimensions that
+   * are only known at run time, take the dynamic path of linearize.
+   */
+  template <int M, int... DIMS>
+  boost::shared_ptr<GaussianFactor> linearizeFixedSize(const Values& x) const {
+    return linearizeFixedSize<M, DIMS...>(
+        x, std::integral_constant<bool, internal::FixedDimensions<M, DIMS...>::value>());
+  }
+
+  /// Per-thread Jacobians for linearizeFixedSize
+  static std::vector<Matrix>& JacobianBuffers();
+
 private:
 
+  template <int M, int... DIMS>
+  boost::shared_ptr<GaussianFactor> linearizeFixedSize(const Values& x,
+                                                       std::false_type) const {
+    return NoiseModelFactor::linearize(x);
+  }
+
+  template <int M, int... DIMS>
+  boost::shared_ptr<GaussianFactor> linearizeFixedSize(const Values& x,
+                                                       std::true_type) const {
+    typedef FixedJacobianFactor<M, DIMS...> Linear;
+    const noiseModel::Diagonal* diagonal =
+        dynamic_cast<const noiseModel::Diagonal*>(noiseModel_.get());
+    if (!active(x) || size() != Linear::N ||
+        (noiseModel_ && (!diagonal || diagonal->isConstrained() ||
+                         noiseModel_->dim() != M)))
+      return NoiseModelFactor::linearize(x);
+
+    // Take the buffers, such that a nested linearization does not use them
+    std::vector<Matrix> A;
+    A.swap(JacobianBuffers());
+    const std::array<DenseIndex, Linear::N> dims = Linear::Dimensions();
+    A.resize(Linear::N);
+    for (size_t j = 0; j < Linear::N; ++j) A[j].resize(M, dims[j]);
+    const Vector e = unwhitenedError(x, A);
+    typename Linear::AugmentedMatrix Ab;
+    if (e.size() == M) {
+      for (DenseIndex j = 0, offset = 0; j < Linear::N; offset += dims[j++])
+        Ab.middleCols(offset, dims[j]) = A[j];
+      Ab.col(Linear::Cols - 1) = -e;
+    }
+    A.swap(JacobianBuffers());
+    if (e.size() != M) return NoiseModelFactor::linearize(x);
+
+    if (diagonal && !diagonal->isUnit())
+      Ab = diagonal->invsigmas().asDiagonal() * Ab;
+    return allocateShared<Linear>(keys_, Ab);
+  }
+
+
   /** Serialization function */
   friend class boost::serialization::access;
   template<class ARCHIVE>
@@ -336,6 +399,16 @@ public:
   virtual Vector evaluateError(const X& x, boost::optional<Matrix&> H =
       boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<M, traits<X>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
@@ -412,6 +485,17 @@ public:
   evaluateError(const X1&, const X2&, boost::optional<Matrix&> H1 =
       boost::none, boost::optional<Matrix&> H2 = boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<
+        M, traits<X1>::dimension, traits<X2>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
@@ -489,6 +573,18 @@ public:
       boost::optional<Matrix&> H2 = boost::none,
       boost::optional<Matrix&> H3 = boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<
+        M, traits<X1>::dimension, traits<X2>::dimension,
+        traits<X3>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
@@ -570,6 +666,18 @@ public:
       boost::optional<Matrix&> H3 = boost::none,
       boost::optional<Matrix&> H4 = boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<
+        M, traits<X1>::dimension, traits<X2>::dimension,
+        traits<X3>::dimension, traits<X4>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
@@ -655,6 +763,19 @@ public:
       boost::optional<Matrix&> H4 = boost::none,
       boost::optional<Matrix&> H5 = boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<
+        M, traits<X1>::dimension, traits<X2>::dimension,
+        traits<X3>::dimension, traits<X4>::dimension,
+        traits<X5>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
@@ -744,6 +865,19 @@ public:
       boost::optional<Matrix&> H5 = boost::none,
       boost::optional<Matrix&> H6 = boost::none) const = 0;
 
+protected:
+
+  /// Linearize into a FixedJacobianFactor with M rows, for derived classes
+  /// whose error dimension M is known at compile time, see
+  /// NoiseModelFactor::linearizeFixedSize
+  template <int M>
+  boost::shared_ptr<GaussianFactor> linearizeFixed(const Values& x) const {
+    return this->template linearizeFixedSize<
+        M, traits<X1>::dimension, traits<X2>::dimension,
+        traits<X3>::dimension, traits<X4>::dimension,
+        traits<X5>::dimension, traits<X6>::dimension>(x);
+  }
+
 private:
 
   /** Serialization function */
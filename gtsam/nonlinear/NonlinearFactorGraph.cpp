@@ -27,14 +27,17 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/inference/FactorGraph-inst.h>
-#include <gtsam/config.h> // for GTSAM_USE_TBB
+#include <gtsam/config.h> // for GTSAM_USE_TBB and GTSAM_USE_THREAD_POOL
 
 #ifdef GTSAM_USE_TBB
 #  include <tbb/parallel_for.h>
+#elif defined GTSAM_USE_THREAD_POOL
+#  include <gtsam/base/ThreadPool.h>
 #endif
 
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 
 using namespace std;
 
@@ -246,11 +249,60 @@ void NonlinearFactorGraph::saveGraph(std::ostream &stm, const Values& values,
 double NonlinearFactorGraph::error(const Values& values) const {
   gttic(NonlinearFactorGraph_error);
   double total_error = 0.;
+#ifdef GTSAM_USE_THREAD_POOL
+
+  // Sum fixed-size blocks in parallel, then the block sums in order, so the
+  // result does not depend on the number of threads
+  static const size_t blockSize = 256;
+  std::vector<double> blockErrors((size() + blockSize - 1) / blockSize, 0.0);
+  ThreadPool::Global().parallelFor(0, size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      if (factors_[i])
+        blockErrors[i / blockSize] += factors_[i]->error(values);
+    }
+  }, blockSize);
+  for (double blockError : blockErrors)
+    total_error += blockError;
+
+#else
+
   // iterate over all the factors_ to accumulate the log probabilities
   for(const sharedFactor& factor: factors_) {
     if(factor)
       total_error += factor->error(values);
   }
+
+#endif
+  return total_error;
+}
+
+/* ************************************************************************* */
+// Mark the factors covered by batches, which have to be disjoint
+static std::vector<bool> coveredFactors(size_t size, const FactorBatches& batches) {
+  std::vector<bool> covered(size, false);
+  for (const FactorBatch::shared_ptr& batch : batches) {
+    for (FactorIndex i : batch->indices()) {
+      if (i >= size || covered[i])
+        throw std::invalid_argument(
+            "NonlinearFactorGraph: factor batches do not match the graph");
+      covered[i] = true;
+    }
+  }
+  return covered;
+}
+
+/* ************************************************************************* */
+double NonlinearFactorGraph::error(const Values& values,
+                                   const FactorBatches& batches) const {
+  gttic(NonlinearFactorGraph_error_batched);
+  const std::vector<bool> covered = coveredFactors(size(), batches);
+  double total_error = 0.;
+  for (const FactorBatch::shared_ptr& batch : batches)
+    total_error += batch->error(values);
+  for (size_t i = 0; i < size(); ++i) {
+    if (factors_[i] && !covered[i])
+      total_error += factors_[i]->error(values);
+  }
   return total_error;
 }
 
@@ -326,6 +378,17 @@ GaussianFactorGraph::shared_ptr NonlinearFactorGraph::linearize(const Values& li
   tbb::parallel_for(tbb::blocked_range<size_t>(0, size()),
     _LinearizeOneFactor(*this, linearizationPoint, *linearFG));
 
+#elif defined GTSAM_USE_THREAD_POOL
+
+  linearFG->resize(size());
+  GaussianFactorGraph& result = *linearFG;
+  ThreadPool::Global().parallelFor(0, size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      if (factors_[i])
+        result[i] = factors_[i]->linearize(linearizationPoint);
+    }
+  });
+
 #else
 
   linearFG->reserve(size());
@@ -343,6 +406,25 @@ GaussianFactorGraph::shared_ptr NonlinearFactorGraph::linearize(const Values& li
   return linearFG;
 }
 
+/* ************************************************************************* */
+GaussianFactorGraph::shared_ptr NonlinearFactorGraph::linearize(
+    const Values& linearizationPoint, const FactorBatches& batches) const {
+  gttic(NonlinearFactorGraph_linearize_batched);
+  const std::vector<bool> covered = coveredFactors(size(), batches);
+
+  GaussianFactorGraph::shared_ptr linearFG = boost::make_shared<GaussianFactorGraph>();
+  linearFG->resize(size());
+  for (const FactorBatch::shared_ptr& batch : batches)
+    batch->linearizeInto(linearizationPoint, linearFG.get());
+
+  // linearize the remaining factors one by one
+  for (size_t i = 0; i < size(); ++i) {
+    if (factors_[i] && !covered[i])
+      (*linearFG)[i] = factors_[i]->linearize(linearizationPoint);
+  }
+  return linearFG;
+}
+
 /* ************************************************************************* */
 static Scatter scatterFromValues(const Values& values) {
   gttic(scatterFromValues);
@@ -23,6 +23,7 @@
 
 #include <gtsam/geometry/Point2.h>
 #include <gtsam/nonlinear/NonlinearFactor.h>
+#include <gtsam/nonlinear/FactorBatch.h>
 #include <gtsam/inference/FactorGraph.h>
 
 #include <boost/shared_ptr.hpp>
@@ -116,6 +117,9 @@ namespace gtsam {
     /** unnormalized error, \f$ 0.5 \sum_i (h_i(X_i)-z)^2/\sigma^2 \f$ in the most common case */
     double error(const Values& values) const;
 
+    /** error(), with the factors covered by \c batches evaluated in batch */
+    double error(const Values& values, const FactorBatches& batches) const;
+
     /** Unnormalized probability. O(n) */
     double probPrime(const Values& values) const;
 
@@ -142,6 +146,10 @@ namespace gtsam {
     /// Linearize a nonlinear factor graph
     boost::shared_ptr<GaussianFactorGraph> linearize(const Values& linearizationPoint) const;
 
+    /// Linearize, with the factors covered by \c batches linearized in batch
+    boost::shared_ptr<GaussianFactorGraph> linearize(const Values& linearizationPoint,
+        const FactorBatches& batches) const;
+
     /// typdef for dampen functions used below
     typedef std::function<void(const boost::shared_ptr<HessianFactor>& hessianFactor)> Dampen;
 
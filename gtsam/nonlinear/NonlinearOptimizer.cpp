@@ -22,10 +22,13 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/SubgraphSolver.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/SupernodalCholesky.h>
+#include <gtsam/linear/SchurComplementSolver.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/VectorValues.h>
 
 #include <gtsam/inference/Ordering.h>
+#include <gtsam/geometry/Point3.h>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/shared_ptr.hpp>
@@ -61,6 +64,17 @@ const Values& NonlinearOptimizer::values() const {
   return state_->values;
 }
 
+/* ************************************************************************* */
+GaussianFactorGraph::shared_ptr NonlinearOptimizer::linearize() const {
+  const NonlinearOptimizerParams& params = _params();
+  if (!params.relinearizeThreshold)
+    return graph_.linearize(state_->values);
+
+  if (!linearizationCache_)
+    linearizationCache_.reset(new LinearizationCache(*params.relinearizeThreshold));
+  return linearizationCache_->linearize(graph_, state_->values);
+}
+
 /* ************************************************************************* */
 void NonlinearOptimizer::defaultOptimize() {
   const NonlinearOptimizerParams& params = _params();
@@ -88,10 +102,25 @@ void NonlinearOptimizer::defaultOptimize() {
   }
 
   // Iterative loop
+  const bool useArena = params.useArena && !params.relinearizeThreshold;
+  if (useArena && !arena_) arena_.reset(new Arena());
   do {
     // Do next iteration
     currentError = error();
-    iterate();
+    if (useArena) {
+      // All temporaries of the iteration are gone once iterate() returns
+      ArenaScope scope(arena_.get());
+      iterate();
+      if (!arena_->reset()) {
+        // Objects of the iteration were kept, they keep the old memory alive
+        if (params.verbosity >= NonlinearOptimizerParams::TERMINATION)
+          cout << "Warning:  " << arena_->liveAllocations()
+               << " objects outlived the iteration, using a new arena" << endl;
+        arena_.reset(new Arena());
+      }
+    } else {
+      iterate();
+    }
     tictoc_finishedIteration();
 
     // Maybe show output
@@ -132,18 +161,34 @@ VectorValues NonlinearOptimizer::solve(const GaussianFactorGraph& gfg,
   // Check which solver we are using
   if (params.isMultifrontal()) {
     // Multifrontal QR or Cholesky (decided by params.getEliminationFunction())
-    if (params.ordering)
-      delta = gfg.optimize(*params.ordering, params.getEliminationFunction());
+    if (params.ordering || params.reuseSymbolic)
+      delta = gfg.optimize(symbolicOrdering(gfg, params), params.getEliminationFunction());
     else
       delta = gfg.optimize(params.getEliminationFunction());
   } else if (params.isSequential()) {
     // Sequential QR or Cholesky (decided by params.getEliminationFunction())
-    if (params.ordering)
-      delta = gfg.eliminateSequential(*params.ordering, params.getEliminationFunction(),
+    if (params.ordering || params.reuseSymbolic)
+      delta = gfg.eliminateSequential(symbolicOrdering(gfg, params), params.getEliminationFunction(),
                                       boost::none, params.orderingType)->optimize();
     else
       delta = gfg.eliminateSequential(params.getEliminationFunction(), boost::none,
                                       params.orderingType)->optimize();
+  } else if (params.isSupernodal()) {
+    // Supernodal sparse Cholesky of the normal equations
+    delta = supernodalFactorization(gfg, params).optimize(gfg);
+  } else if (params.isSchurComplement()) {
+    // Eliminate the points in closed form, then solve the reduced camera system
+    // with PCG if PCG parameters are given, or sparse Cholesky otherwise
+    KeyVector points;
+    for (const auto key_value : values())
+      if (dynamic_cast<const GenericValue<Point3>*>(&key_value.value))
+        points.push_back(key_value.key);
+    const SchurComplementSolver schur(gfg, points);
+    if (boost::shared_ptr<PCGSolverParameters> pcg =
+            boost::dynamic_pointer_cast<PCGSolverParameters>(params.iterativeParams))
+      delta = schur.backSubstitute(PCGSolver(*pcg).optimize(schur.reducedSystem()));
+    else
+      delta = schur.optimize();
   } else if (params.isIterative()) {
     // Conjugate Gradient -> needs params.iterativeParams
     if (!params.iterativeParams)
@@ -169,6 +214,27 @@ VectorValues NonlinearOptimizer::solve(const GaussianFactorGraph& gfg,
   return delta;
 }
 
+/* ************************************************************************* */
+const Ordering& NonlinearOptimizer::symbolicOrdering(
+    const GaussianFactorGraph& gfg, const NonlinearOptimizerParams& params) const {
+  if (params.ordering)
+    return *params.ordering;
+  if (!ordering_ || !params.reuseSymbolic)
+    ordering_ = Ordering::Create(params.orderingType, gfg);
+  return *ordering_;
+}
+
+/* ************************************************************************* */
+SupernodalCholesky& NonlinearOptimizer::supernodalFactorization(
+    const GaussianFactorGraph& gfg, const NonlinearOptimizerParams& params) const {
+  // Only redo the symbolic analysis if asked to, or if the structure changed
+  if (!supernodal_ || !params.reuseSymbolic || !supernodal_->hasSameStructure(gfg)) {
+    if (supernodal_) ordering_ = boost::none;
+    supernodal_.reset(new SupernodalCholesky(gfg, symbolicOrdering(gfg, params)));
+  }
+  return *supernodal_;
+}
+
 /* ************************************************************************* */
 bool checkConvergence(double relativeErrorTreshold, double absoluteErrorTreshold,
                       double errorThreshold, double currentError, double newError,
@@ -20,6 +20,8 @@
 
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/nonlinear/NonlinearOptimizerParams.h>
+#include <gtsam/linear/SupernodalCholesky.h>
+#include <gtsam/base/Arena.h>
 
 namespace gtsam {
 
@@ -79,6 +81,18 @@ protected:
 
   std::unique_ptr<internal::NonlinearOptimizerState> state_; ///< PIMPL'd state
 
+  /// Linear factors kept across iterations when params.relinearizeThreshold is set
+  mutable std::unique_ptr<LinearizationCache> linearizationCache_;
+
+  /// Memory for the temporaries of one iteration when params.useArena is set
+  std::unique_ptr<Arena> arena_;
+
+  /// Fill-reducing ordering kept across iterations when params.reuseSymbolic is set
+  mutable boost::optional<Ordering> ordering_;
+
+  /// Supernodal factorization kept across iterations when params.reuseSymbolic is set
+  mutable std::unique_ptr<SupernodalCholesky> supernodal_;
+
 public:
   /** A shared pointer to this class */
   typedef boost::shared_ptr<const NonlinearOptimizer> shared_ptr;
@@ -126,12 +140,36 @@ public:
   virtual VectorValues solve(const GaussianFactorGraph &gfg,
       const NonlinearOptimizerParams& params) const;
 
+  /**
+   * The elimination ordering used by solve(): params.ordering if given, or
+   * one computed from params.orderingType.  With params.reuseSymbolic set,
+   * the computed ordering is cached and reused in later iterations.
+   */
+  const Ordering& symbolicOrdering(const GaussianFactorGraph& gfg,
+                                   const NonlinearOptimizerParams& params) const;
+
+  /**
+   * The supernodal factorization used by solve() for SUPERNODAL_CHOLESKY,
+   * with its symbolic analysis done for \c gfg.  With params.reuseSymbolic
+   * set, the analysis of previous iterations is reused if the structure is
+   * the same.
+   */
+  SupernodalCholesky& supernodalFactorization(const GaussianFactorGraph& gfg,
+                                              const NonlinearOptimizerParams& params) const;
+
   /** 
    * Perform a single iteration, returning GaussianFactorGraph corresponding to 
    * the linearized factor graph.
    */
   virtual GaussianFactorGraph::shared_ptr iterate() = 0;
 
+  /**
+   * Linearize the graph at the current values, can be overwritten. If
+   * params.relinearizeThreshold is set, linear factors are re-used across
+   * iterations for variables that moved less than the threshold.
+   */
+  virtual GaussianFactorGraph::shared_ptr linearize() const;
+
   /// @}
 
 protected:
@@ -100,6 +100,12 @@ void NonlinearOptimizerParams::print(const std::string& str) const {
   case CHOLMOD:
     std::cout << "         linear solver type: CHOLMOD\n";
     break;
+  case SUPERNODAL_CHOLESKY:
+    std::cout << "         linear solver type: SUPERNODAL CHOLESKY\n";
+    break;
+  case SCHUR_COMPLEMENT:
+    std::cout << "         linear solver type: SCHUR COMPLEMENT\n";
+    break;
   case Iterative:
     std::cout << "         linear solver type: ITERATIVE\n";
     break;
@@ -120,6 +126,18 @@ void NonlinearOptimizerParams::print(const std::string& str) const {
     break;
   }
 
+  if (relinearizeThreshold) {
+    std::cout << "     relinearize threshold: ";
+    if (const double* threshold = boost::get<double>(&*relinearizeThreshold))
+      std::cout << *threshold << "\n";
+    else
+      std::cout << "per variable type\n";
+  }
+  if (useArena)
+    std::cout << "                 use arena: true\n";
+  if (reuseSymbolic)
+    std::cout << "            reuse symbolic: true\n";
+
   std::cout.flush();
 }
 
@@ -139,6 +157,10 @@ std::string NonlinearOptimizerParams::linearSolverTranslator(
     return "ITERATIVE";
   case CHOLMOD:
     return "CHOLMOD";
+  case SUPERNODAL_CHOLESKY:
+    return "SUPERNODAL_CHOLESKY";
+  case SCHUR_COMPLEMENT:
+    return "SCHUR_COMPLEMENT";
   default:
     throw std::invalid_argument(
         "Unknown linear solver type in SuccessiveLinearizationOptimizer");
@@ -160,6 +182,10 @@ NonlinearOptimizerParams::LinearSolverType NonlinearOptimizerParams::linearSolve
     return Iterative;
   if (linearSolverType == "CHOLMOD")
     return CHOLMOD;
+  if (linearSolverType == "SUPERNODAL_CHOLESKY")
+    return SUPERNODAL_CHOLESKY;
+  if (linearSolverType == "SCHUR_COMPLEMENT")
+    return SCHUR_COMPLEMENT;
   throw std::invalid_argument(
       "Unknown linear solver type in SuccessiveLinearizationOptimizer");
 }
@@ -23,6 +23,7 @@
 
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/SubgraphSolver.h>
+#include <gtsam/nonlinear/LinearizationCache.h>
 #include <boost/optional.hpp>
 #include <string>
 
@@ -48,7 +49,7 @@ public:
   NonlinearOptimizerParams() :
       maxIterations(100), relativeErrorTol(1e-5), absoluteErrorTol(1e-5), errorTol(
           0.0), verbosity(SILENT), orderingType(Ordering::COLAMD),
-          linearSolverType(MULTIFRONTAL_CHOLESKY) {}
+          linearSolverType(MULTIFRONTAL_CHOLESKY), useArena(false), reuseSymbolic(false) {}
 
   virtual ~NonlinearOptimizerParams() {
   }
@@ -79,11 +80,16 @@ public:
     SEQUENTIAL_QR,
     Iterative, /* Experimental Flag */
     CHOLMOD, /* Experimental Flag */
+    SUPERNODAL_CHOLESKY, ///< Sparse Cholesky of the normal equations, see SupernodalCholesky
+    SCHUR_COMPLEMENT, ///< Eliminate the Point3 variables first, in closed form, see SchurComplementSolver
   };
 
   LinearSolverType linearSolverType; ///< The type of linear solver to use in the nonlinear optimizer
   boost::optional<Ordering> ordering; ///< The optional variable elimination ordering, or empty to use COLAMD (default: empty)
   IterativeOptimizationParameters::shared_ptr iterativeParams; ///< The container for iterativeOptimization parameters. used in CG Solvers.
+  boost::optional<LinearizationCache::RelinearizationThreshold> relinearizeThreshold; ///< If set, only factors on variables that moved more than this threshold are re-linearized in each iteration, see LinearizationCache (default: empty, re-linearize all factors)
+  bool useArena; ///< If true, the linear factors, conditionals and cliques of each iteration are allocated from an Arena that is reset after the iteration. Ignored when relinearizeThreshold is set, since linear factors then outlive the iteration (default: false)
+  bool reuseSymbolic; ///< If true, the symbolic factorization is computed once and reused by every linear solve, as the structure of the linearized graph does not change between iterations: the fill-reducing ordering for MULTIFRONTAL_* and SEQUENTIAL_*, and the full supernode structure and assembly maps for SUPERNODAL_CHOLESKY (default: false)
 
   inline bool isMultifrontal() const {
     return (linearSolverType == MULTIFRONTAL_CHOLESKY)
@@ -99,6 +105,14 @@ public:
     return (linearSolverType == CHOLMOD);
   }
 
+  inline bool isSupernodal() const {
+    return (linearSolverType == SUPERNODAL_CHOLESKY);
+  }
+
+  inline bool isSchurComplement() const {
+    return (linearSolverType == SCHUR_COMPLEMENT);
+  }
+
   inline bool isIterative() const {
     return (linearSolverType == Iterative);
   }
@@ -129,6 +143,18 @@ public:
 
   void setIterativeParams(const boost::shared_ptr<IterativeOptimizationParameters> params);
 
+  void setRelinearizeThreshold(double threshold) {
+    relinearizeThreshold = LinearizationCache::RelinearizationThreshold(threshold);
+  }
+
+  void setUseArena(bool useArena) {
+    this->useArena = useArena;
+  }
+
+  void setReuseSymbolic(bool reuseSymbolic) {
+    this->reuseSymbolic = reuseSymbolic;
+  }
+
   void setOrdering(const Ordering& ordering) {
     this->ordering = ordering;
     this->orderingType = Ordering::CUSTOM;
@@ -24,6 +24,7 @@
 
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/FlatVectorValues.h>
 
 #ifdef __GNUC__
 #pragma GCC diagnostic push
@@ -67,6 +68,18 @@ namespace gtsam {
     }
   }
 
+  /* ************************************************************************* */
+  Values::Values(const Values& other, const FlatVectorValues& delta) {
+    for (const_iterator key_value = other.begin(); key_value != other.end(); ++key_value) {
+      Key key = key_value->key;  // Non-const duplicate to deal with non-const insert argument
+      if (delta.exists(key)) {
+        values_.insert(key, key_value->value.retract_(delta.at(key).data()));
+      } else {
+        values_.insert(key, key_value->value.clone_());
+      }
+    }
+  }
+
   /* ************************************************************************* */
   void Values::print(const string& str, const KeyFormatter& keyFormatter) const {
     cout << str << "Values with " << size() << " values:" << endl;
@@ -103,6 +116,11 @@ namespace gtsam {
     return Values(*this, delta);
   }
 
+  /* ************************************************************************* */
+  Values Values::retract(const FlatVectorValues& delta) const {
+    return Values(*this, delta);
+  }
+
   /* ************************************************************************* */
   VectorValues Values::localCoordinates(const Values& cp) const {
     if(this->size() != cp.size())
@@ -48,6 +48,7 @@ namespace gtsam {
 
   // Forward declarations / utilities
   class VectorValues;
+  class FlatVectorValues;
   class ValueAutomaticCasting;
   template<typename T> static bool _truePredicate(const T&) { return true; }
 
@@ -153,6 +154,9 @@ namespace gtsam {
     /** Construct from a Values and an update vector: identical to other.retract(delta) */
     Values(const Values& other, const VectorValues& delta);
 
+    /** Construct from a Values and an update vector: identical to other.retract(delta) */
+    Values(const Values& other, const FlatVectorValues& delta);
+
     /** Constructor from a Filtered view copies out all values */
     template<class ValueType>
     Values(const Filtered<ValueType>& view);
@@ -246,6 +250,9 @@ namespace gtsam {
     /** Add a delta config to current config and returns a new config */
     Values retract(const VectorValues& delta) const;
 
+    /** Add a delta config stored in a single contiguous vector */
+    Values retract(const FlatVectorValues& delta) const;
+
     /** Get a delta config about a linearization point c0 (*this) */
     VectorValues localCoordinates(const Values& cp) const;
 
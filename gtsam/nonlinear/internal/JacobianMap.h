@@ -27,24 +27,45 @@ namespace internal {
 
 // A JacobianMap is the primary mechanism by which derivatives are returned.
 // Expressions are designed to write their derivatives into an already allocated
-// Jacobian of the correct size, of type VerticalBlockMatrix.
+// Jacobian of the correct size, of type VerticalBlockMatrix, or into any
+// column-major matrix, e.g., a fixed-size one on the stack.
 // The JacobianMap provides a mapping from keys to the underlying blocks.
 class JacobianMap {
+public:
+  typedef Eigen::Map<Matrix, 0, Eigen::OuterStride<> > Block;
+
 private:
   const KeyVector& keys_;
-  VerticalBlockMatrix& Ab_;
+  VerticalBlockMatrix* Ab_;
+  double* data_;
+  DenseIndex rows_;
+  const DenseIndex* offsets_;
 
 public:
   /// Construct a JacobianMap for writing into a VerticalBlockMatrix Ab
   JacobianMap(const KeyVector& keys, VerticalBlockMatrix& Ab) :
-      keys_(keys), Ab_(Ab) {
+      keys_(keys), Ab_(&Ab), data_(0), rows_(0), offsets_(0) {
+  }
+
+  /// Construct a JacobianMap for writing into a column-major matrix with
+  /// \c rows rows, where the block of keys[i] has columns
+  /// [offsets[i], offsets[i+1])
+  JacobianMap(const KeyVector& keys, double* data, DenseIndex rows,
+      const DenseIndex* offsets) :
+      keys_(keys), Ab_(0), data_(data), rows_(rows), offsets_(offsets) {
   }
 
   /// Access blocks of via key
-  VerticalBlockMatrix::Block operator()(Key key) {
+  Block operator()(Key key) {
     KeyVector::const_iterator it = std::find(keys_.begin(), keys_.end(), key);
     DenseIndex block = it - keys_.begin();
-    return Ab_(block);
+    if (Ab_) {
+      VerticalBlockMatrix::Block Ai = (*Ab_)(block);
+      return Block(Ai.data(), Ai.rows(), Ai.cols(),
+          Eigen::OuterStride<>(Ai.outerStride()));
+    }
+    return Block(data_ + offsets_[block] * rows_, rows_,
+        offsets_[block + 1] - offsets_[block], Eigen::OuterStride<>(rows_));
   }
 };
 
@@ -22,6 +22,7 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/NoiseModel.h>
+#include <gtsam/base/Arena.h>
 #include <gtsam/base/Matrix.h>
 #include <gtsam/base/Vector.h>
 
@@ -130,7 +131,7 @@ struct LevenbergMarquardtState : public NonlinearOptimizerState {
       const Key key = key_value.key;
       const size_t dim = key_value.value.dim();
       const CachedModel* item = getCachedModel(dim);
-      damped += boost::make_shared<JacobianFactor>(key, item->A, item->b, item->model);
+      damped += allocateShared<JacobianFactor>(key, item->A, item->b, item->model);
     }
     return damped;
   }
@@ -146,7 +147,7 @@ struct LevenbergMarquardtState : public NonlinearOptimizerState {
         const size_t dim = key_vector.second.size();
         CachedModel* item = getCachedModel(dim);
         item->A.diagonal() = sqrtHessianDiagonal.at(key);  // use diag(hessian)
-        damped += boost::make_shared<JacobianFactor>(key, item->A, item->b, item->model);
+        damped += allocateShared<JacobianFactor>(key, item->A, item->b, item->model);
       } catch (const std::out_of_range&) {
         continue;  // Don't attempt any damping if no key found in diagonal
       }
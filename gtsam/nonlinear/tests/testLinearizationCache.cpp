@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testLinearizationCache.cpp
+ * @brief   Unit tests for LinearizationCache
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/nonlinear/LinearizationCache.h>
+#include <gtsam/nonlinear/LinearContainerFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+static const SharedNoiseModel model2 = noiseModel::Isotropic::Sigma(2, 0.1);
+static const SharedNoiseModel model3 = noiseModel::Isotropic::Sigma(3, 0.1);
+
+/* ************************************************************************* */
+// Linear (in Point2) graph, so that shifted linear factors are exact
+static NonlinearFactorGraph linearGraph() {
+  NonlinearFactorGraph graph;
+  graph += PriorFactor<Point2>(L(1), Point2(0, 0), model2);
+  graph += BetweenFactor<Point2>(L(1), L(2), Point2(1, 0), model2);
+  graph += BetweenFactor<Point2>(L(2), L(3), Point2(1, 1), model2);
+  return graph;
+}
+
+static Values linearValues(double offset) {
+  Values values;
+  values.insert(L(1), Point2(0.1 + offset, 0.2));
+  values.insert(L(2), Point2(1.3, -0.1 - offset));
+  values.insert(L(3), Point2(2.2 + offset, 0.9));
+  return values;
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, zeroThreshold) {
+  NonlinearFactorGraph graph = linearGraph();
+  LinearizationCache cache(0.0);
+
+  Values values = linearValues(0.0);
+  GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, values);
+  EXPECT(assert_equal(*graph.linearize(values), *actual));
+  EXPECT_LONGS_EQUAL(3, cache.lastRelinearized());
+
+  // With a zero threshold everything is relinearized every time
+  values = linearValues(0.01);
+  actual = cache.linearize(graph, values);
+  EXPECT(assert_equal(*graph.linearize(values), *actual));
+  EXPECT_LONGS_EQUAL(3, cache.lastRelinearized());
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, shiftJacobians) {
+  NonlinearFactorGraph graph = linearGraph();
+  LinearizationCache cache(1.0);
+
+  cache.linearize(graph, linearValues(0.0));
+  EXPECT_LONGS_EQUAL(3, cache.lastRelinearized());
+
+  // Below threshold: nothing is relinearized, but the graph is still exact
+  Values values = linearValues(0.1);
+  GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(0, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+  EXPECT(assert_equal(linearValues(0.0), cache.linearizationPoint()));
+
+  // Above threshold: only factors on L(1) and L(3) are relinearized
+  values = linearValues(0.1);
+  values.update(L(1), Point2(5, 5));
+  values.update(L(3), Point2(-5, 5));
+  actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(3, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+
+  values.update(L(3), Point2(-7, 5));
+  actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(1, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, shiftHessian) {
+  HessianFactor hessian(L(1), L(2), (Matrix(2, 2) << 4, 1, 1, 3).finished(),
+                        (Matrix(2, 2) << 0.5, 0, 0.2, 1).finished(),
+                        Vector2(1, 2), (Matrix(2, 2) << 5, 1, 1, 6).finished(),
+                        Vector2(-1, 0.5), 10.0);
+  Values linearizationPoint = linearValues(0.0);
+  linearizationPoint.erase(L(3));
+
+  NonlinearFactorGraph graph;
+  graph += LinearContainerFactor(hessian, linearizationPoint);
+
+  LinearizationCache cache(1.0);
+  cache.linearize(graph, linearizationPoint);
+
+  Values values = linearValues(0.2);
+  values.erase(L(3));
+  GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(0, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, perKeyThreshold) {
+  NonlinearFactorGraph graph;
+  graph += PriorFactor<Pose2>(X(1), Pose2(), model3);
+  graph += BetweenFactor<Pose2>(X(1), X(2), Pose2(1, 0, 0), model3);
+  graph += PriorFactor<Point2>(L(1), Point2(1, 1), model2);
+
+  FastMap<char, Vector> thresholds;
+  thresholds['x'] = Vector3(0.1, 0.1, 0.01);
+  thresholds['l'] = Vector2(1.0, 1.0);
+  LinearizationCache cache(thresholds);
+
+  Values values;
+  values.insert(X(1), Pose2(0, 0, 0));
+  values.insert(X(2), Pose2(1, 0, 0));
+  values.insert(L(1), Point2(1, 1));
+  cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(3, cache.lastRelinearized());
+
+  // Only the rotation of X(2) exceeds its threshold
+  values.update(X(2), Pose2(1, 0, 0.05));
+  values.update(L(1), Point2(1.5, 1));
+  cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(1, cache.lastRelinearized());
+
+  // A missing threshold vector is an error
+  thresholds.erase('l');
+  LinearizationCache incomplete(thresholds);
+  incomplete.linearize(graph, values);
+  CHECK_EXCEPTION(incomplete.linearize(graph, values), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, newFactors) {
+  NonlinearFactorGraph graph = linearGraph();
+  LinearizationCache cache(1.0);
+  cache.linearize(graph, linearValues(0.0));
+
+  // Replaced and appended factors are linearized, the others are re-used
+  graph.replace(1, boost::make_shared<BetweenFactor<Point2> >(
+                       L(1), L(2), Point2(2, 0), model2));
+  graph += BetweenFactor<Point2>(L(1), L(3), Point2(2, 1), model2);
+  Values values = linearValues(0.0);
+  GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(2, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+
+  // Removing factors resets the cache
+  graph.resize(2);
+  actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(2, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, newVariables) {
+  NonlinearFactorGraph graph = linearGraph();
+  LinearizationCache cache(1.0);
+  cache.linearize(graph, linearValues(0.0));
+
+  // A new factor between a slightly moved variable and a new one
+  graph += BetweenFactor<Point2>(L(3), L(4), Point2(0, 1), model2);
+  graph += BetweenFactor<Point2>(L(4), L(1), Point2(-3, -2), model2);
+  Values values = linearValues(0.1);
+  values.insert(L(4), Point2(2.1, 2.0));
+  GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(2, cache.lastRelinearized());
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+
+  // The same with Hessian factors, which are shifted as a whole
+  HessianFactor hessian(L(2), L(5), (Matrix(2, 2) << 4, 1, 1, 3).finished(),
+                        (Matrix(2, 2) << 0.5, 0, 0.2, 1).finished(),
+                        Vector2(1, 2), (Matrix(2, 2) << 5, 1, 1, 6).finished(),
+                        Vector2(-1, 0.5), 10.0);
+  Values linearizationPoint;
+  linearizationPoint.insert(L(2), values.at<Point2>(L(2)));
+  linearizationPoint.insert(L(5), Point2(0.3, 0.4));
+  graph += LinearContainerFactor(hessian, linearizationPoint);
+  values = linearValues(0.15);
+  values.insert(L(4), Point2(2.1, 2.0));
+  values.insert(L(5), Point2(0.3, 0.4));
+  actual = cache.linearize(graph, values);
+  EXPECT(assert_equal(*graph.linearize(values), *actual, 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -17,6 +17,9 @@
  */
 
 #include <gtsam/nonlinear/Values.h>
+#include <gtsam/nonlinear/ISAM2.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/PriorFactor.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/geometry/PinholeCamera.h>
 #include <gtsam/geometry/Pose2.h>
@@ -82,6 +85,74 @@ TEST (Serialization, TemplatedValues) {
   EXPECT(equalsBinary(values));
 }
 
+/* ************************************************************************* */
+// Export the types in an ISAM2 on poses
+GTSAM_VALUE_EXPORT(gtsam::Pose2);
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Diagonal, "gtsam_noiseModel_Diagonal");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Isotropic, "gtsam_noiseModel_Isotropic");
+BOOST_CLASS_EXPORT_GUID(gtsam::JacobianFactor, "gtsam::JacobianFactor");
+BOOST_CLASS_EXPORT_GUID(gtsam::HessianFactor, "gtsam::HessianFactor");
+BOOST_CLASS_EXPORT_GUID(gtsam::GaussianConditional, "gtsam::GaussianConditional");
+BOOST_CLASS_EXPORT_GUID(gtsam::PriorFactor<gtsam::Pose2>, "gtsam::PriorFactorPose2");
+BOOST_CLASS_EXPORT_GUID(gtsam::BetweenFactor<gtsam::Pose2>, "gtsam::BetweenFactorPose2");
+// The linearizations of the factors above, cached in ISAM2
+typedef gtsam::FixedJacobianFactor<3, 3> FixedJacobianFactor33;
+typedef gtsam::FixedJacobianFactor<3, 3, 3> FixedJacobianFactor333;
+BOOST_CLASS_EXPORT_GUID(FixedJacobianFactor33, "gtsam::FixedJacobianFactor33");
+BOOST_CLASS_EXPORT_GUID(FixedJacobianFactor333, "gtsam::FixedJacobianFactor333");
+
+/* ************************************************************************* */
+// Odometry from pose i-1 to i, and a loop closure every 5 poses
+static void addPose(size_t i, NonlinearFactorGraph* graph, Values* values) {
+  const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  const Pose2 odometry(1.0, 0.0, 0.3);
+  if (i == 0) {
+    graph->emplace_shared<PriorFactor<Pose2> >(0, Pose2(), model);
+    values->insert(0, Pose2(0.1, -0.1, 0.02));
+    return;
+  }
+  graph->emplace_shared<BetweenFactor<Pose2> >(i - 1, i, odometry, model);
+  if (i % 5 == 0)
+    graph->emplace_shared<BetweenFactor<Pose2> >(i - 5, i, Pose2(), model);
+  values->insert(i, Pose2(0.1 * i, 0.05 * i, 0.3 * i));
+}
+
+/* ************************************************************************* */
+TEST (Serialization, ISAM2) {
+  ISAM2Params params;
+  params.relinearizeSkip = 3;
+  params.relinearizeThreshold = 0.01;
+  ISAM2 isam(params);
+  for (size_t i = 0; i < 20; i++) {
+    NonlinearFactorGraph graph;
+    Values values;
+    addPose(i, &graph, &values);
+    isam.update(graph, values);
+  }
+
+  // Checkpoint, and restore into a default-constructed instance
+  const string checkpoint = serializeBinary(isam);
+  ISAM2 restored;
+  deserializeBinary(checkpoint, restored);
+  EXPECT(assert_equal(isam, restored));
+  EXPECT_LONGS_EQUAL(3, restored.params().relinearizeSkip);
+  EXPECT(assert_equal(isam.getDelta(), restored.getDelta()));
+  EXPECT(assert_equal(isam.calculateEstimate(), restored.calculateEstimate()));
+
+  // Both continue identically, including the periodic relinearization
+  for (size_t i = 20; i < 30; i++) {
+    NonlinearFactorGraph graph;
+    Values values;
+    addPose(i, &graph, &values);
+    const ISAM2Result expected = isam.update(graph, values);
+    const ISAM2Result actual = restored.update(graph, values);
+    EXPECT_LONGS_EQUAL(expected.variablesRelinearized,
+                       actual.variablesRelinearized);
+  }
+  EXPECT(assert_equal(isam, restored));
+  EXPECT(assert_equal(isam.calculateEstimate(), restored.calculateEstimate()));
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
 /* ************************************************************************* */
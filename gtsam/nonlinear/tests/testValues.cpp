@@ -19,6 +19,7 @@
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/FlatVectorValues.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/geometry/Pose3.h>
 #include <gtsam/base/Testable.h>
@@ -235,6 +236,25 @@ TEST(Values, retract_partial)
   CHECK(assert_equal(expected, Values(config0, delta)));
 }
 
+/* ************************************************************************* */
+TEST(Values, retract_flat)
+{
+  Values config0;
+  config0.insert(key1, Vector3(1.0, 2.0, 3.0));
+  config0.insert(key2, Vector3(5.0, 6.0, 7.0));
+
+  Scatter scatter;
+  scatter.add(key2, 3);
+  FlatVectorValues delta(Vector3(1.3, 1.4, 1.5), scatter);
+
+  Values expected;
+  expected.insert(key1, Vector3(1.0, 2.0, 3.0));
+  expected.insert(key2, Vector3(6.3, 7.4, 8.5));
+
+  CHECK(assert_equal(expected, config0.retract(delta)));
+  CHECK(assert_equal(expected, Values(config0, delta)));
+}
+
 /* ************************************************************************* */
 TEST(Values, equals)
 {
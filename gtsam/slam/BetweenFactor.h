@@ -102,6 +102,11 @@ namespace gtsam {
 #endif
     }
 
+    /// Linearize into a FixedJacobianFactor if VALUE has a fixed dimension
+    virtual boost::shared_ptr<GaussianFactor> linearize(const Values& x) const {
+      return this->template linearizeFixed<traits<T>::dimension>(x);
+    }
+
     /** return the measured */
     const VALUE& measured() const {
       return measured_;
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BetweenFactorBatch.h
+ * @brief   Evaluate all BetweenFactors of one value type of a graph at once
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/nonlinear/FactorBatch.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/base/Arena.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/ThreadPool.h>
+
+#include <typeinfo>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The BetweenFactor<VALUE>s of a graph, e.g., the odometry and loop closures
+ * read by readG2o, in structure-of-arrays form: measurements, square root
+ * information matrices and variable indices are stored in contiguous arrays,
+ * and the variables are read from Values once per variable rather than twice
+ * per factor.  Errors and Jacobians are then computed with fixed-size
+ * matrices, in one loop over the factors, in parallel when GTSAM is built with
+ * the thread pool.
+ *
+ * Only factors of exactly type BetweenFactor<VALUE> with a (non-constrained)
+ * Gaussian noise model are collected, all others are left to be evaluated one
+ * by one.  Use with NonlinearFactorGraph::error and linearize, e.g.
+ * \code
+ *   FactorBatches batches{boost::make_shared<BetweenFactorBatch<Pose3> >(graph)};
+ *   GaussianFactorGraph::shared_ptr linear = graph.linearize(values, batches);
+ * \endcode
+ */
+template <class VALUE>
+class BetweenFactorBatch : public FactorBatch {
+ public:
+  typedef BetweenFactor<VALUE> Factor;
+
+  enum { Dim = traits<VALUE>::dimension };
+  BOOST_STATIC_ASSERT_MSG(Dim != Eigen::Dynamic,
+                          "BetweenFactorBatch needs a fixed-size VALUE");
+
+  typedef Eigen::Matrix<double, Dim, 1> VectorD;
+  typedef Eigen::Matrix<double, Dim, Dim> MatrixD;
+
+  /// Collect the factors of type Factor in \c graph
+  explicit BetweenFactorBatch(const NonlinearFactorGraph& graph) {
+    FastMap<Key, size_t> variables;
+    auto variable = [&](Key key) {
+      const auto it = variables.emplace(key, keys_.size());
+      if (it.second) keys_.push_back(key);
+      return it.first->second;
+    };
+    for (size_t i = 0; i < graph.size(); ++i) {
+      if (!graph[i] || typeid(*graph[i]) != typeid(Factor)) continue;
+      const Factor& factor = static_cast<const Factor&>(*graph[i]);
+      const noiseModel::Gaussian* gaussian =
+          dynamic_cast<const noiseModel::Gaussian*>(factor.noiseModel().get());
+      if (!gaussian || gaussian->isConstrained()) continue;
+      indices_.push_back(i);
+      first_.push_back(variable(factor.key1()));
+      second_.push_back(variable(factor.key2()));
+      measured_.push_back(factor.measured());
+      R_.push_back(gaussian->R());
+    }
+  }
+
+  /// The variables, in the order in which they are read from Values
+  const KeyVector& keys() const { return keys_; }
+
+  /// Sum of the errors 0.5*|R*Local(z, Between(x1, x2))|^2 of all factors
+  virtual double error(const Values& values) const {
+    const ValueVector x = gather(values);
+    std::vector<double> errors(size());
+    parallelFor([&](size_t begin, size_t end) {
+      for (size_t k = begin; k < end; ++k) {
+        const VALUE hx = traits<VALUE>::Between(x[first_[k]], x[second_[k]]);
+        const VectorD e = R_[k] * traits<VALUE>::Local(measured_[k], hx);
+        errors[k] = 0.5 * e.squaredNorm();
+      }
+    });
+    double total = 0.0;
+    for (double e : errors) total += e;
+    return total;
+  }
+
+  /// Linearize every factor into a JacobianFactor, as NoiseModelFactor does
+  virtual void linearizeInto(const Values& values,
+                             GaussianFactorGraph* linear) const {
+    const ValueVector x = gather(values);
+    GaussianFactorGraph& result = *linear;
+    parallelFor([&](size_t begin, size_t end) {
+      MatrixD H1, H2;
+      for (size_t k = begin; k < end; ++k) {
+        const VALUE hx =
+            traits<VALUE>::Between(x[first_[k]], x[second_[k]], H1, H2);
+#ifdef SLOW_BUT_CORRECT_BETWEENFACTOR
+        MatrixD Hlocal;
+        const VectorD e = traits<VALUE>::Local(measured_[k], hx, boost::none,
+                                               Hlocal);
+        H1 = Hlocal * H1;
+        H2 = Hlocal * H2;
+#else
+        const VectorD e = traits<VALUE>::Local(measured_[k], hx);
+#endif
+        const MatrixD& R = R_[k];
+        result[indices_[k]] = allocateShared<JacobianFactor>(
+            keys_[first_[k]], Matrix(R * H1), keys_[second_[k]],
+            Matrix(R * H2), Vector(-(R * e)));
+      }
+    });
+  }
+
+ private:
+  typedef std::vector<VALUE, Eigen::aligned_allocator<VALUE> > ValueVector;
+
+  /// Read every variable once, in the order of keys()
+  ValueVector gather(const Values& values) const {
+    ValueVector x;
+    x.reserve(keys_.size());
+    for (Key key : keys_) x.push_back(values.at<VALUE>(key));
+    return x;
+  }
+
+  /// Call function(begin, end) on ranges of factors, in parallel if enabled
+  template <typename FUNCTION>
+  void parallelFor(const FUNCTION& function) const {
+#ifdef GTSAM_USE_THREAD_POOL
+    // Factors write disjoint results, so no synchronization is needed
+    static const size_t grainSize = 256;
+    ThreadPool::Global().parallelFor(0, size(), function, grainSize);
+#else
+    function(0, size());
+#endif
+  }
+
+  KeyVector keys_;             ///< Variables, in order of first use
+  std::vector<size_t> first_;  ///< Index in keys_ of the first variable
+  std::vector<size_t> second_; ///< Index in keys_ of the second variable
+  std::vector<VALUE, Eigen::aligned_allocator<VALUE> > measured_;
+  std::vector<MatrixD, Eigen::aligned_allocator<MatrixD> > R_;  ///< Whitening
+};
+
+}  // namespace gtsam
@@ -98,6 +98,11 @@ namespace gtsam {
       return -traits<T>::Local(x, prior_);
     }
 
+    /// Linearize into a FixedJacobianFactor if VALUE has a fixed dimension
+    virtual boost::shared_ptr<GaussianFactor> linearize(const Values& x) const {
+      return this->template linearizeFixed<traits<T>::dimension>(x);
+    }
+
     const VALUE & prior() const { return prior_; }
 
   private:
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    RegularImplicitSchurBatch.h
+ * @brief   Hessian-vector products of many RegularImplicitSchurFactors at once
+ * @date    Oct 16, 2026
+ */
+
+#pragma once
+
+#include <gtsam/slam/RegularImplicitSchurFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/ThreadPool.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The RegularImplicitSchurFactors of a graph, for one camera type, copied
+ * into contiguous arrays: the F and E blocks of all factors follow each
+ * other, in factor order, and the cameras are numbered by their position in
+ * keys().  multiplyHessianAdd then computes y += F'*alpha*(I - E*P*E')*F*x
+ * for all factors in two passes over these arrays, with fixed-size kernels,
+ * instead of a virtual call per factor that looks up every camera in x and y:
+ *  - the per-measurement products F'*alpha*(I - E*P*E')*F*x, in parallel
+ *    over factors when GTSAM is built with the thread pool,
+ *  - their sum per camera, in parallel over cameras, which needs no locking.
+ *
+ * Like the factors, a batch keeps scratch space, and can only be used by one
+ * thread at a time.
+ *
+ * To use it in PCGSolver, set PCGSolverParameters::hessianBatch_ to Create.
+ */
+template <class CAMERA>
+class RegularImplicitSchurBatch : public HessianBatch {
+ public:
+  typedef RegularImplicitSchurFactor<CAMERA> Factor;
+
+  static const int D = traits<CAMERA>::dimension;  ///< Camera dimension
+  static const int ZDim =
+      traits<typename CAMERA::Measurement>::dimension;  ///< Measurement dimension
+
+  typedef Eigen::Matrix<double, ZDim, D> MatrixZD;
+  typedef Eigen::Matrix<double, ZDim, 3> MatrixZ3;
+  typedef Eigen::Matrix<double, D, 1> VectorD;
+  typedef Eigen::Matrix<double, ZDim, 1> VectorZ;
+
+  /// Collect the factors of type Factor in \c graph, other factors are ignored
+  explicit RegularImplicitSchurBatch(const GaussianFactorGraph& graph) {
+    factorStarts_.push_back(0);
+    FastMap<Key, size_t> cameraIndices;
+    std::vector<std::vector<size_t> > slotsOfCamera;
+    for (const GaussianFactor::shared_ptr& factor : graph) {
+      const auto implicit = boost::dynamic_pointer_cast<Factor>(factor);
+      if (!implicit) continue;
+      if (implicit->getPointCovariance().rows() != 3)
+        throw std::invalid_argument(
+            "RegularImplicitSchurBatch: only non-degenerate points are "
+            "supported");
+      P_.push_back(implicit->getPointCovariance());
+      for (size_t k = 0; k < implicit->size(); ++k) {
+        const Key key = implicit->keys()[k];
+        const auto it = cameraIndices.emplace(key, keys_.size());
+        if (it.second) {
+          keys_.push_back(key);
+          slotsOfCamera.emplace_back();
+        }
+        slotsOfCamera[it.first->second].push_back(cameras_.size());
+        cameras_.push_back(it.first->second);
+        F_.push_back(implicit->FBlocks()[k]);
+        E_.push_back(implicit->E().template block<ZDim, 3>(ZDim * k, 0));
+      }
+      factorStarts_.push_back(cameras_.size());
+    }
+
+    // The measurements of each camera, for the reduction
+    cameraStarts_.push_back(0);
+    for (const std::vector<size_t>& slots : slotsOfCamera) {
+      cameraSlots_.insert(cameraSlots_.end(), slots.begin(), slots.end());
+      cameraStarts_.push_back(cameraSlots_.size());
+    }
+    products_.resize(cameras_.size());
+  }
+
+  /// Factory for PCGSolverParameters::hessianBatch_, null without any Factor
+  static HessianBatch::shared_ptr Create(const GaussianFactorGraph& graph) {
+    const auto batch = boost::make_shared<RegularImplicitSchurBatch>(graph);
+    if (batch->size() == 0) return HessianBatch::shared_ptr();
+    return batch;
+  }
+
+  /// Whether \c factor is a Factor, i.e., one of the factors of the batch
+  virtual bool covers(const GaussianFactor& factor) const {
+    return dynamic_cast<const Factor*>(&factor) != nullptr;
+  }
+
+  /// Number of factors in the batch
+  size_t size() const { return P_.size(); }
+
+  /// Number of measurements, i.e., F blocks, of all factors
+  size_t numMeasurements() const { return cameras_.size(); }
+
+  /// The cameras, in the order of their results
+  const KeyVector& keys() const { return keys_; }
+
+  /// y += F'*alpha*(I - E*P*E')*F*x, summed over all factors
+  virtual void multiplyHessianAdd(double alpha, const VectorValues& x,
+                                  VectorValues& y) const {
+    // Gather x once per camera, rather than once per measurement
+    xs_.resize(keys_.size());
+    for (size_t i = 0; i < keys_.size(); ++i) xs_[i] = x.at(keys_[i]);
+    computeProducts(alpha,
+                    [this](size_t i) -> const VectorD& { return xs_[i]; });
+
+    sumProducts();
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      static const Vector empty;
+      const auto it = y.tryInsert(keys_[i], empty);
+      Vector& yi = it.first->second;
+      if (it.second) yi = Vector::Zero(D);
+      yi += sums_[i];
+    }
+  }
+
+  /**
+   * Raw memory version of multiplyHessianAdd, which assumes, as the factor
+   * does, that the keys are 0 to M-1 and x and y are laid out that way.
+   */
+  void multiplyHessianAdd(double alpha, const double* x, double* y) const {
+    typedef Eigen::Map<const VectorD> ConstDMap;
+    computeProducts(alpha,
+                    [&](size_t i) { return ConstDMap(x + D * keys_[i]); });
+
+    sumProducts();
+    for (size_t i = 0; i < keys_.size(); ++i)
+      Eigen::Map<VectorD>(y + D * keys_[i]) += sums_[i];
+  }
+
+ private:
+  typedef std::vector<VectorD, Eigen::aligned_allocator<VectorD> > VectorDs;
+
+  /// F'*alpha*(I - E*P*E')*F*x for every measurement, into products_
+  template <class XBLOCK>
+  void computeProducts(double alpha, const XBLOCK& xBlock) const {
+    auto compute = [&](size_t begin, size_t end) {
+      // Every factor has only a few measurements, so errors stay on the stack
+      static const size_t kMaxCameras = 64;
+      VectorZ e[kMaxCameras];
+      for (size_t f = begin; f < end; ++f) {
+        const size_t m = factorStarts_[f + 1] - factorStarts_[f];
+        computeFactor(f, alpha, xBlock, m <= kMaxCameras ? e : nullptr);
+      }
+    };
+#ifdef GTSAM_USE_THREAD_POOL
+    // Factors write disjoint measurements, so no synchronization is needed
+    static const size_t grainSize = 64;
+    ThreadPool::Global().parallelFor(0, size(), compute, grainSize);
+#else
+    compute(0, size());
+#endif
+  }
+
+  /// Products of factor \c f, using buffer \c e for its errors if given
+  template <class XBLOCK>
+  void computeFactor(size_t f, double alpha, const XBLOCK& xBlock,
+                     VectorZ* e) const {
+    const size_t first = factorStarts_[f], last = factorStarts_[f + 1];
+    std::vector<VectorZ, Eigen::aligned_allocator<VectorZ> > heap;
+    if (!e) {
+      heap.resize(last - first);
+      e = heap.data();
+    }
+
+    // e = F*x and d = E'*e
+    Eigen::Vector3d d = Eigen::Vector3d::Zero();
+    for (size_t s = first; s < last; ++s) {
+      e[s - first].noalias() = F_[s] * xBlock(cameras_[s]);
+      d.noalias() += E_[s].transpose() * e[s - first];
+    }
+    const Eigen::Vector3d Pd = P_[f] * d;
+
+    // products = F'*alpha*(e - E*P*E'*e)
+    for (size_t s = first; s < last; ++s) {
+      const VectorZ e2 = e[s - first] - E_[s] * Pd;
+      products_[s].noalias() = alpha * (F_[s].transpose() * e2);
+    }
+  }
+
+  /// Sum the products of every camera into sums_
+  void sumProducts() const {
+    sums_.resize(keys_.size());
+    auto sum = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        VectorD& result = sums_[i];
+        result.setZero();
+        for (size_t k = cameraStarts_[i]; k < cameraStarts_[i + 1]; ++k)
+          result += products_[cameraSlots_[k]];
+      }
+    };
+#ifdef GTSAM_USE_THREAD_POOL
+    static const size_t grainSize = 256;
+    ThreadPool::Global().parallelFor(0, keys_.size(), sum, grainSize);
+#else
+    sum(0, keys_.size());
+#endif
+  }
+
+  KeyVector keys_;                     ///< Cameras, in order of first use
+  std::vector<size_t> factorStarts_;   ///< First measurement of each factor
+  std::vector<size_t> cameras_;        ///< Camera index of each measurement
+  std::vector<size_t> cameraStarts_;   ///< First entry of each camera
+  std::vector<size_t> cameraSlots_;    ///< Measurements of each camera
+  std::vector<MatrixZD, Eigen::aligned_allocator<MatrixZD> > F_;
+  std::vector<MatrixZ3, Eigen::aligned_allocator<MatrixZ3> > E_;
+  std::vector<Eigen::Matrix3d, Eigen::aligned_allocator<Eigen::Matrix3d> > P_;
+
+  mutable VectorDs products_;  ///< Scratch: product of every measurement
+  mutable VectorDs xs_;        ///< Scratch: x of every camera
+  mutable VectorDs sums_;      ///< Scratch: result of every camera
+};
+
+}  // namespace gtsam
@@ -17,7 +17,12 @@
 
 #include <gtsam/sam/BearingRangeFactor.h>
 #include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/GeneralSFMFactor.h>
+#include <gtsam/slam/PriorFactor.h>
 #include <gtsam/slam/dataset.h>
+#include <gtsam/navigation/GPSFactor.h>
+#include <gtsam/navigation/ImuBias.h>
+#include <gtsam/navigation/NavState.h>
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/geometry/Rot3.h>
@@ -33,15 +38,32 @@
 #include <gtsam/base/types.h>
 #include <gtsam/base/Value.h>
 #include <gtsam/base/Vector.h>
+#include <gtsam/base/ThreadPool.h>
+#include <gtsam/config.h>
 
 #include <boost/assign/list_inserter.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <stdexcept>
+#include <typeindex>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 namespace fs = boost::filesystem;
@@ -109,12 +131,10 @@ GraphAndValues load2D(pair<string, SharedNoiseModel> dataset, int maxID,
 }
 
 /* ************************************************************************* */
-// Read noise parameters and interpret them according to flags
-static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
-    NoiseFormat noiseFormat, KernelFunctionType kernelFunctionType) {
-  double v1, v2, v3, v4, v5, v6;
-  is >> v1 >> v2 >> v3 >> v4 >> v5 >> v6;
-
+// Interpret noise parameters according to flags
+static SharedNoiseModel createNoiseModel(double v1, double v2, double v3,
+    double v4, double v5, double v6, bool smart, NoiseFormat noiseFormat,
+    KernelFunctionType kernelFunctionType) {
   if (noiseFormat == NoiseFormatAUTO) {
     // Try to guess covariance matrix layout
     if (v1 != 0.0 && v2 == 0.0 && v3 != 0.0 && v4 != 0.0 && v5 == 0.0
@@ -191,6 +211,16 @@ static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
   }
 }
 
+/* ************************************************************************* */
+// Read noise parameters and interpret them according to flags
+static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
+    NoiseFormat noiseFormat, KernelFunctionType kernelFunctionType) {
+  double v1, v2, v3, v4, v5, v6;
+  is >> v1 >> v2 >> v3 >> v4 >> v5 >> v6;
+  return createNoiseModel(v1, v2, v3, v4, v5, v6, smart, noiseFormat,
+                          kernelFunctionType);
+}
+
 /* ************************************************************************* */
 boost::optional<IndexedPose> parseVertex(istream& is, const string& tag) {
   if ((tag == "VERTEX2") || (tag == "VERTEX_SE2") || (tag == "VERTEX")) {
@@ -510,6 +540,238 @@ void writeG2o(const NonlinearFactorGraph& graph, const Values& estimate,
   stream.close();
 }
 
+/* ************************************************************************* */
+namespace {
+
+/// The contents of a file, memory-mapped where supported, read otherwise
+class MappedFile {
+ public:
+  MappedFile() : data_(nullptr), size_(0), mapped_(false) {}
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Map or read the file, returns false if it can not be read
+  bool open(const string& filename) {
+#ifndef _WIN32
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        data_ = static_cast<const char*>(data);
+        size_ = st.st_size;
+        mapped_ = true;
+      }
+    }
+    ::close(fd);
+    if (mapped_) return true;
+#endif
+    // Not mapped, e.g. empty or on Windows: read it instead
+    ifstream is(filename.c_str(), ios::binary);
+    if (!is) return false;
+    buffer_.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+  }
+
+  const char* begin() const { return data_; }
+  const char* end() const { return data_ + size_; }
+
+ private:
+  const char* data_;
+  size_t size_;
+  bool mapped_;
+  string buffer_;
+};
+
+/// Reads whitespace-separated fields from [begin, end), which need not be
+/// null-terminated, faster than a stringstream
+class Tokenizer {
+ public:
+  Tokenizer(const char* begin, const char* end) : p_(begin), end_(end) {}
+
+  /// The next field, empty at the end
+  string token() {
+    const char* first = skip();
+    return string(first, p_);
+  }
+
+  /// The next field as a double, 0 if there is none
+  double number() { return convert(strtod); }
+
+  /// The next field as a float, parsed as such
+  float singleNumber() { return convert(strtof); }
+
+  /// The next field as an unsigned integer
+  Key key() {
+    return convert([](const char* str, char** endptr) {
+      return static_cast<Key>(strtoull(str, endptr, 10));
+    });
+  }
+
+ private:
+  /// Skip whitespace and the next field, return the start of the field
+  const char* skip() {
+    while (p_ != end_ && isspace(static_cast<unsigned char>(*p_))) ++p_;
+    const char* first = p_;
+    while (p_ != end_ && !isspace(static_cast<unsigned char>(*p_))) ++p_;
+    return first;
+  }
+
+  /// Parse the next field with a strto* function, from a terminated copy
+  template <typename CONVERT>
+  auto convert(CONVERT strto) -> decltype(strto(nullptr, nullptr)) {
+    const char* first = skip();
+    char buffer[64];
+    const size_t n = min<size_t>(p_ - first, sizeof(buffer) - 1);
+    copy(first, first + n, buffer);
+    buffer[n] = '\0';
+    return strto(buffer, nullptr);
+  }
+
+  const char* p_;
+  const char* end_;
+};
+
+/// Insert a pose unless it exists: the first occurrence of a pose is kept
+template <class POSE>
+void insertPose(Key id, const POSE& pose, Values* values) {
+  if (!values->exists(id)) values->insert(id, pose);
+}
+
+/// Parse the poses and pose constraints of the lines in [begin, end)
+void parseG2oLines(const char* begin, const char* end, bool is3D,
+                   KernelFunctionType kernelFunctionType,
+                   NonlinearFactorGraph* graph, Values* values) {
+  while (begin != end) {
+    const char* eol =
+        static_cast<const char*>(memchr(begin, '\n', end - begin));
+    if (!eol) eol = end;
+    Tokenizer ls(begin, eol);
+    begin = (eol == end) ? end : eol + 1;
+    const string tag = ls.token();
+
+    if (!is3D) {
+      if (tag == "VERTEX_SE2" || tag == "VERTEX2" || tag == "VERTEX") {
+        const Key id = ls.key();
+        const double x = ls.number(), y = ls.number(), yaw = ls.number();
+        insertPose(id, Pose2(x, y, yaw), values);
+      } else if (tag == "EDGE_SE2" || tag == "EDGE2" || tag == "EDGE" ||
+                 tag == "ODOMETRY") {
+        const Key id1 = ls.key(), id2 = ls.key();
+        const double x = ls.number(), y = ls.number(), yaw = ls.number();
+        double v[6];
+        for (double& vi : v) vi = ls.number();
+        graph->emplace_shared<BetweenFactor<Pose2> >(
+            id1, id2, Pose2(x, y, yaw),
+            createNoiseModel(v[0], v[1], v[2], v[3], v[4], v[5], true,
+                             NoiseFormatG2O, kernelFunctionType));
+      }
+      continue;
+    }
+
+    if (tag == "VERTEX3") {
+      const Key id = ls.key();
+      const double x = ls.number(), y = ls.number(), z = ls.number();
+      const double roll = ls.number(), pitch = ls.number(), yaw = ls.number();
+      insertPose(id, Pose3(Rot3::Ypr(yaw, pitch, roll), Point3(x, y, z)),
+                 values);
+    } else if (tag == "VERTEX_SE3:QUAT") {
+      const Key id = ls.key();
+      const double x = ls.number(), y = ls.number(), z = ls.number();
+      const double qx = ls.number(), qy = ls.number(), qz = ls.number(),
+                   qw = ls.number();
+      insertPose(id, Pose3(Rot3::Quaternion(qw, qx, qy, qz), Point3(x, y, z)),
+                 values);
+    } else if (tag == "EDGE3" || tag == "EDGE_SE3:QUAT") {
+      const Key id1 = ls.key(), id2 = ls.key();
+      const double x = ls.number(), y = ls.number(), z = ls.number();
+      Rot3 R;
+      if (tag == "EDGE3") {
+        const double roll = ls.number(), pitch = ls.number(), yaw = ls.number();
+        R = Rot3::Ypr(yaw, pitch, roll);
+      } else {
+        const double qx = ls.number(), qy = ls.number(), qz = ls.number(),
+                     qw = ls.number();
+        R = Rot3::Quaternion(qw, qx, qy, qz);
+      }
+      // Upper triangle of the information matrix
+      Matrix6 m;
+      for (size_t i = 0; i < 6; i++)
+        for (size_t j = i; j < 6; j++) m(i, j) = m(j, i) = ls.number();
+      if (tag == "EDGE_SE3:QUAT") {
+        // g2o orders translation before rotation
+        Matrix6 mgtsam;
+        mgtsam << m.block<3, 3>(3, 3), m.block<3, 3>(0, 3),
+                  m.block<3, 3>(3, 0), m.block<3, 3>(0, 0);
+        m = mgtsam;
+      }
+      SharedNoiseModel model = noiseModel::Gaussian::Information(m);
+      if (kernelFunctionType == KernelFunctionTypeHUBER)
+        model = noiseModel::Robust::Create(
+            noiseModel::mEstimator::Huber::Create(1.345), model);
+      else if (kernelFunctionType == KernelFunctionTypeTUKEY)
+        model = noiseModel::Robust::Create(
+            noiseModel::mEstimator::Tukey::Create(4.6851), model);
+      graph->emplace_shared<BetweenFactor<Pose3> >(
+          id1, id2, Pose3(R, Point3(x, y, z)), model);
+    }
+  }
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+void streamG2o(const string& filename, const GraphChunkCallback& callback,
+               bool is3D, KernelFunctionType kernelFunctionType,
+               size_t chunkBytes) {
+  MappedFile file;
+  if (!file.open(filename))
+    throw invalid_argument("streamG2o: can not find file " + filename);
+
+  // Split the file into chunks at line boundaries
+  const size_t step = chunkBytes > 0 ? chunkBytes : 1;
+  vector<const char*> bounds(1, file.begin());
+  while (bounds.back() != file.end()) {
+    const size_t remaining = file.end() - bounds.back();
+    const char* next = bounds.back() + min(step, remaining);
+    next = find(next, file.end(), '\n');
+    bounds.push_back(next == file.end() ? next : next + 1);
+  }
+  const size_t nrChunks = bounds.size() - 1;
+
+  // Parse a window of chunks at a time, in parallel, and pass them on in order
+  size_t window = 1;
+#ifdef GTSAM_USE_THREAD_POOL
+  window = 2 * ThreadPool::Global().numThreads();
+#endif
+  for (size_t first = 0; first < nrChunks; first += window) {
+    const size_t n = min(window, nrChunks - first);
+    vector<NonlinearFactorGraph> graphs(n);
+    vector<Values> values(n);
+    auto parse = [&](size_t begin, size_t end) {
+      for (size_t c = begin; c < end; ++c)
+        parseG2oLines(bounds[first + c], bounds[first + c + 1], is3D,
+                      kernelFunctionType, &graphs[c], &values[c]);
+    };
+#ifdef GTSAM_USE_THREAD_POOL
+    ThreadPool::Global().parallelFor(0, n, parse, 1);
+#else
+    parse(0, n);
+#endif
+    for (size_t c = 0; c < n; ++c) callback(graphs[c], values[c]);
+  }
+}
+
 /* ************************************************************************* */
 std::map<Key, Pose3> parse3DPoses(const string& filename) {
   ifstream is(filename.c_str());
@@ -528,13 +790,13 @@ std::map<Key, Pose3> parse3DPoses(const string& filename) {
       Key id;
       double x, y, z, roll, pitch, yaw;
       ls >> id >> x >> y >> z >> roll >> pitch >> yaw;
-      poses.emplace(id, Pose3(Rot3::Ypr(yaw, pitch, roll), {x, y, z}));
+      poses.emplace(id, Pose3(Rot3::Ypr(yaw, pitch, roll), Point3(x, y, z)));
     }
     if (tag == "VERTEX_SE3:QUAT") {
       Key id;
       double x, y, z, qx, qy, qz, qw;
       ls >> id >> x >> y >> z >> qx >> qy >> qz >> qw;
-      poses.emplace(id, Pose3(Rot3::Quaternion(qw, qx, qy, qz), {x, y, z}));
+      poses.emplace(id, Pose3(Rot3::Quaternion(qw, qx, qy, qz), Point3(x, y, z)));
     }
   }
   return poses;
@@ -562,7 +824,7 @@ BetweenFactorPose3s parse3DFactors(const string& filename) {
         for (size_t j = i; j < 6; j++) ls >> m(i, j);
       SharedNoiseModel model = noiseModel::Gaussian::Information(m);
       factors.emplace_back(new BetweenFactor<Pose3>(
-          id1, id2, Pose3(Rot3::Ypr(yaw, pitch, roll), {x, y, z}), model));
+          id1, id2, Pose3(Rot3::Ypr(yaw, pitch, roll), Point3(x, y, z)), model));
     }
     if (tag == "EDGE_SE3:QUAT") {
       Key id1, id2;
@@ -586,7 +848,7 @@ BetweenFactorPose3s parse3DFactors(const string& filename) {
 
       SharedNoiseModel model = noiseModel::Gaussian::Information(mgtsam);
       factors.emplace_back(new BetweenFactor<Pose3>(
-          id1, id2, Pose3(Rot3::Quaternion(qw, qx, qy, qz), {x, y, z}), model));
+          id1, id2, Pose3(Rot3::Quaternion(qw, qx, qy, qz), Point3(x, y, z)), model));
     }
   }
   return factors;
@@ -594,18 +856,17 @@ BetweenFactorPose3s parse3DFactors(const string& filename) {
 
 /* ************************************************************************* */
 GraphAndValues load3D(const string& filename) {
-  const auto factors = parse3DFactors(filename);
   NonlinearFactorGraph::shared_ptr graph(new NonlinearFactorGraph);
-  for (const auto& factor : factors) {
-    graph->push_back(factor);
-  }
-
-  const auto poses = parse3DPoses(filename);
   Values::shared_ptr initial(new Values);
-  for (const auto& key_pose : poses) {
-    initial->insert(key_pose.first, key_pose.second);
-  }
-
+  const bool is3D = true;
+  streamG2o(filename, [&](const NonlinearFactorGraph& factors,
+                          const Values& values) {
+    graph->push_back(factors);
+    // As in parse3DPoses, the first occurrence of a pose is kept
+    for (const Values::ConstKeyValuePair& key_value : values)
+      if (!initial->exists(key_value.key))
+        initial->insert(key_value.key, key_value.value);
+  }, is3D);
   return make_pair(graph, initial);
 }
 
@@ -734,43 +995,44 @@ bool readBundler(const string& filename, SfM_data &data) {
 
 /* ************************************************************************* */
 bool readBAL(const string& filename, SfM_data &data) {
-  // Load the data file
-  ifstream is(filename.c_str(), ifstream::in);
-  if (!is) {
+  // Map the data file, and parse it without the overhead of a stream
+  MappedFile file;
+  if (!file.open(filename)) {
     cout << "Error in readBAL: can not find the file!!" << endl;
     return false;
   }
+  Tokenizer is(file.begin(), file.end());
 
   // Get the number of camera poses and 3D points
-  size_t nrPoses, nrPoints, nrObservations;
-  is >> nrPoses >> nrPoints >> nrObservations;
+  const size_t nrPoses = is.key(), nrPoints = is.key(),
+               nrObservations = is.key();
 
   data.tracks.resize(nrPoints);
 
   // Get the information for the observations
   for (size_t k = 0; k < nrObservations; k++) {
-    size_t i = 0, j = 0;
-    float u, v;
-    is >> i >> j >> u >> v;
+    const size_t i = is.key(), j = is.key();
+    const float u = is.singleNumber(), v = is.singleNumber();
     data.tracks[j].measurements.emplace_back(i, Point2(u, -v));
   }
 
   // Get the information for the camera poses
+  data.cameras.reserve(nrPoses);
   for (size_t i = 0; i < nrPoses; i++) {
     // Get the Rodrigues vector
-    float wx, wy, wz;
-    is >> wx >> wy >> wz;
+    const float wx = is.singleNumber(), wy = is.singleNumber(),
+                wz = is.singleNumber();
     Rot3 R = Rot3::Rodrigues(wx, wy, wz); // BAL-OpenGL rotation matrix
 
     // Get the translation vector
-    float tx, ty, tz;
-    is >> tx >> ty >> tz;
+    const float tx = is.singleNumber(), ty = is.singleNumber(),
+                tz = is.singleNumber();
 
     Pose3 pose = openGL2gtsam(R, tx, ty, tz);
 
     // Get the focal length and the radial distortion parameters
-    float f, k1, k2;
-    is >> f >> k1 >> k2;
+    const float f = is.singleNumber(), k1 = is.singleNumber(),
+                k2 = is.singleNumber();
     Cal3Bundler K(f, k1, k2);
 
     data.cameras.emplace_back(pose, K);
@@ -779,8 +1041,8 @@ bool readBAL(const string& filename, SfM_data &data) {
   // Get the information for the 3D points
   for (size_t j = 0; j < nrPoints; j++) {
     // Get the 3D position
-    float x, y, z;
-    is >> x >> y >> z;
+    const float x = is.singleNumber(), y = is.singleNumber(),
+                z = is.singleNumber();
     SfM_Track& track = data.tracks[j];
     track.p = Point3(x, y, z);
     track.r = 0.4f;
@@ -788,7 +1050,6 @@ bool readBAL(const string& filename, SfM_data &data) {
     track.b = 0.4f;
   }
 
-  is.close();
   return true;
 }
 
@@ -943,4 +1204,671 @@ Values initialCamerasAndPointsEstimate(const SfM_data& db) {
   return initial;
 }
 
+/* ************************************************************************* */
+namespace {
+
+/// Value types in the binary graph format; never renumber, only append
+enum BinaryValueType : uint64_t {
+  kPose2 = 1, kPose3, kPoint2, kPoint3, kRot2, kRot3, kVector3, kVector,
+  kConstantBias, kNavState, kCal3Bundler, kSfMCamera
+};
+
+/// Factor kinds: a factor code is (kind << 8 | value type)
+enum BinaryFactorKind : uint64_t {
+  kNullFactor = 0, kPrior, kBetween, kBearingRange, kGeneralSFM, kGPS
+};
+
+/// Noise model kinds, and robust kernels
+enum BinaryModelKind : uint64_t { kUnit = 1, kIsotropic, kDiagonal, kGaussian,
+                                  kRobust };
+enum BinaryKernel : uint64_t { kHuber = 1, kCauchy, kTukey };
+
+const char kBinaryMagic[8] = {'G', 'T', 'S', 'A', 'M', 'B', 'I', 'N'};
+const uint64_t kBinaryVersion = 1;
+const uint64_t kBinaryByteOrder = 0x0102030405060708;
+const size_t kBinaryHeaderWords = 6;
+
+/// Appends 8-byte words, integers or doubles, to a buffer
+class BinaryWriter {
+ public:
+  void word(uint64_t w) { words_.push_back(w); }
+
+  void number(double d) {
+    uint64_t w;
+    memcpy(&w, &d, sizeof(w));
+    words_.push_back(w);
+  }
+
+  template <class MATRIX>
+  void numbers(const Eigen::DenseBase<MATRIX>& m) {
+    for (DenseIndex j = 0; j < m.cols(); j++)
+      for (DenseIndex i = 0; i < m.rows(); i++) number(m(i, j));
+  }
+
+  vector<uint64_t>& words() { return words_; }
+
+ private:
+  vector<uint64_t> words_;
+};
+
+/// Reads 8-byte words from a buffer, e.g., a mapped file, without copying it
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, size_t size)
+      : p_(data), end_(data + size - size % sizeof(uint64_t)) {}
+
+  uint64_t word() {
+    if (p_ == end_)
+      throw invalid_argument("readBinaryGraph: unexpected end of data");
+    uint64_t w;
+    memcpy(&w, p_, sizeof(w));
+    p_ += sizeof(w);
+    return w;
+  }
+
+  double number() {
+    const uint64_t w = word();
+    double d;
+    memcpy(&d, &w, sizeof(d));
+    return d;
+  }
+
+  template <class MATRIX>
+  void numbers(Eigen::DenseBase<MATRIX>& m) {
+    for (DenseIndex j = 0; j < m.cols(); j++)
+      for (DenseIndex i = 0; i < m.rows(); i++) m(i, j) = number();
+  }
+
+ private:
+  const char* p_;
+  const char* end_;
+};
+
+/* ************************************************************************* */
+// Encoding and decoding of the supported value types
+void encode(const Pose2& x, BinaryWriter* out) {
+  out->number(x.x());
+  out->number(x.y());
+  out->number(x.theta());
+}
+void decode(BinaryReader* in, Pose2* x) {
+  const double px = in->number(), py = in->number();
+  *x = Pose2(px, py, in->number());
+}
+
+void encode(const Rot2& R, BinaryWriter* out) {
+  out->number(R.c());
+  out->number(R.s());
+}
+void decode(BinaryReader* in, Rot2* R) {
+  const double c = in->number();
+  *R = Rot2::fromCosSin(c, in->number());
+}
+
+void encode(const Rot3& R, BinaryWriter* out) { out->numbers(R.matrix()); }
+void decode(BinaryReader* in, Rot3* R) {
+  Matrix3 m;
+  in->numbers(m);
+  *R = Rot3(m);
+}
+
+void encode(const Point2& p, BinaryWriter* out) { out->numbers(Vector2(p)); }
+void decode(BinaryReader* in, Point2* p) {
+  Vector2 v;
+  in->numbers(v);
+  *p = Point2(v);
+}
+
+void encode(const Point3& p, BinaryWriter* out) { out->numbers(Vector3(p)); }
+void decode(BinaryReader* in, Point3* p) {
+  Vector3 v;
+  in->numbers(v);
+  *p = Point3(v);
+}
+
+#ifndef GTSAM_TYPEDEF_POINTS_TO_VECTORS
+void encode(const Vector3& v, BinaryWriter* out) { out->numbers(v); }
+void decode(BinaryReader* in, Vector3* v) { in->numbers(*v); }
+#endif
+
+void encode(const Vector& v, BinaryWriter* out) {
+  out->word(v.size());
+  out->numbers(v);
+}
+void decode(BinaryReader* in, Vector* v) {
+  v->resize(in->word());
+  in->numbers(*v);
+}
+
+void encode(const Pose3& x, BinaryWriter* out) {
+  encode(x.rotation(), out);
+  encode(x.translation(), out);
+}
+void decode(BinaryReader* in, Pose3* x) {
+  Rot3 R;
+  Point3 t;
+  decode(in, &R);
+  decode(in, &t);
+  *x = Pose3(R, t);
+}
+
+void encode(const imuBias::ConstantBias& b, BinaryWriter* out) {
+  out->numbers(b.vector());
+}
+void decode(BinaryReader* in, imuBias::ConstantBias* b) {
+  Vector6 v;
+  in->numbers(v);
+  *b = imuBias::ConstantBias(v.head<3>(), v.tail<3>());
+}
+
+void encode(const NavState& x, BinaryWriter* out) {
+  encode(x.attitude(), out);
+  encode(x.position(), out);
+  out->numbers(x.velocity());
+}
+void decode(BinaryReader* in, NavState* x) {
+  Rot3 R;
+  Point3 t;
+  Vector3 v;
+  decode(in, &R);
+  decode(in, &t);
+  in->numbers(v);
+  *x = NavState(R, t, v);
+}
+
+void encode(const Cal3Bundler& K, BinaryWriter* out) {
+  out->number(K.fx());
+  out->number(K.k1());
+  out->number(K.k2());
+  out->number(K.u0());
+  out->number(K.v0());
+}
+void decode(BinaryReader* in, Cal3Bundler* K) {
+  double v[5];
+  for (double& vi : v) vi = in->number();
+  *K = Cal3Bundler(v[0], v[1], v[2], v[3], v[4]);
+}
+
+void encode(const SfM_Camera& camera, BinaryWriter* out) {
+  encode(camera.pose(), out);
+  encode(camera.calibration(), out);
+}
+void decode(BinaryReader* in, SfM_Camera* camera) {
+  Pose3 pose;
+  Cal3Bundler K;
+  decode(in, &pose);
+  decode(in, &K);
+  *camera = SfM_Camera(pose, K);
+}
+
+void encode(const Unit3& u, BinaryWriter* out) { out->numbers(u.unitVector()); }
+void decode(BinaryReader* in, Unit3* u) {
+  Vector3 v;
+  in->numbers(v);
+  *u = Unit3(v);
+}
+
+void encode(double d, BinaryWriter* out) { out->number(d); }
+void decode(BinaryReader* in, double* d) { *d = in->number(); }
+
+/* ************************************************************************* */
+// Writing and reading of values and factors, through function pointers such
+// that the supported types can be looked up in a table
+struct ValueCodec {
+  void (*write)(const Value&, BinaryWriter*);
+  void (*read)(Key, BinaryReader*, Values*);
+};
+
+template <class T>
+struct ValueCodecs {
+  static void write(const Value& value, BinaryWriter* out) {
+    encode(static_cast<const GenericValue<T>&>(value).value(), out);
+  }
+  static void read(Key key, BinaryReader* in, Values* values) {
+    T x;
+    decode(in, &x);
+    values->insert(key, x);
+  }
+};
+
+struct FactorCodec {
+  void (*write)(const NonlinearFactor&, BinaryWriter*);
+  NonlinearFactor::shared_ptr (*read)(BinaryReader*, const SharedNoiseModel&);
+};
+
+template <class T>
+struct PriorCodec {
+  static void write(const NonlinearFactor& factor, BinaryWriter* out) {
+    const PriorFactor<T>& f = static_cast<const PriorFactor<T>&>(factor);
+    out->word(f.key());
+    encode(f.prior(), out);
+  }
+  static NonlinearFactor::shared_ptr read(BinaryReader* in,
+                                          const SharedNoiseModel& model) {
+    const Key key = in->word();
+    T prior;
+    decode(in, &prior);
+    return boost::make_shared<PriorFactor<T> >(key, prior, model);
+  }
+};
+
+template <class T>
+struct BetweenCodec {
+  static void write(const NonlinearFactor& factor, BinaryWriter* out) {
+    const BetweenFactor<T>& f = static_cast<const BetweenFactor<T>&>(factor);
+    out->word(f.key1());
+    out->word(f.key2());
+    encode(f.measured(), out);
+  }
+  static NonlinearFactor::shared_ptr read(BinaryReader* in,
+                                          const SharedNoiseModel& model) {
+    const Key key1 = in->word(), key2 = in->word();
+    T measured;
+    decode(in, &measured);
+    return boost::make_shared<BetweenFactor<T> >(key1, key2, measured, model);
+  }
+};
+
+template <class POSE, class POINT>
+struct BearingRangeCodec {
+  typedef BearingRangeFactor<POSE, POINT> Factor;
+  static void write(const NonlinearFactor& factor, BinaryWriter* out) {
+    const Factor& f = static_cast<const Factor&>(factor);
+    out->word(f.keys()[0]);
+    out->word(f.keys()[1]);
+    encode(f.measured().bearing(), out);
+    encode(f.measured().range(), out);
+  }
+  static NonlinearFactor::shared_ptr read(BinaryReader* in,
+                                          const SharedNoiseModel& model) {
+    const Key key1 = in->word(), key2 = in->word();
+    typename Bearing<POSE, POINT>::result_type bearing;
+    typename Range<POSE, POINT>::result_type range;
+    decode(in, &bearing);
+    decode(in, &range);
+    return boost::make_shared<Factor>(key1, key2, bearing, range, model);
+  }
+};
+
+struct GeneralSFMCodec {
+  typedef GeneralSFMFactor<SfM_Camera, Point3> Factor;
+  static void write(const NonlinearFactor& factor, BinaryWriter* out) {
+    const Factor& f = static_cast<const Factor&>(factor);
+    out->word(f.keys()[0]);
+    out->word(f.keys()[1]);
+    encode(f.measured(), out);
+  }
+  static NonlinearFactor::shared_ptr read(BinaryReader* in,
+                                          const SharedNoiseModel& model) {
+    const Key cameraKey = in->word(), landmarkKey = in->word();
+    Point2 measured;
+    decode(in, &measured);
+    return boost::make_shared<Factor>(measured, model, cameraKey, landmarkKey);
+  }
+};
+
+struct GPSCodec {
+  static void write(const NonlinearFactor& factor, BinaryWriter* out) {
+    const GPSFactor& f = static_cast<const GPSFactor&>(factor);
+    out->word(f.key());
+    encode(f.measurementIn(), out);
+  }
+  static NonlinearFactor::shared_ptr read(BinaryReader* in,
+                                          const SharedNoiseModel& model) {
+    const Key key = in->word();
+    Point3 measured;
+    decode(in, &measured);
+    return boost::make_shared<GPSFactor>(key, measured, model);
+  }
+};
+
+/// The supported types, by C++ type for writing and by code for reading
+class BinaryCodecs {
+ public:
+  BinaryCodecs() {
+    addValue<Pose2>(kPose2);
+    addValue<Pose3>(kPose3);
+    addValue<Point2>(kPoint2);
+    addValue<Point3>(kPoint3);
+    addValue<Rot2>(kRot2);
+    addValue<Rot3>(kRot3);
+#ifndef GTSAM_TYPEDEF_POINTS_TO_VECTORS
+    addValue<Vector3>(kVector3);
+#endif
+    addValue<Vector>(kVector);
+    addValue<imuBias::ConstantBias>(kConstantBias);
+    addValue<NavState>(kNavState);
+    addValue<Cal3Bundler>(kCal3Bundler);
+    addValue<SfM_Camera>(kSfMCamera);
+    addBetween<Pose2>(kPose2);
+    addBetween<Pose3>(kPose3);
+    addBetween<Point2>(kPoint2);
+    addBetween<Point3>(kPoint3);
+    addBetween<Rot2>(kRot2);
+    addBetween<Rot3>(kRot3);
+#ifndef GTSAM_TYPEDEF_POINTS_TO_VECTORS
+    addBetween<Vector3>(kVector3);
+#endif
+    addBetween<imuBias::ConstantBias>(kConstantBias);
+    addFactor<BearingRangeFactor<Pose2, Point2>,
+              BearingRangeCodec<Pose2, Point2> >(kBearingRange, kPose2);
+    addFactor<BearingRangeFactor<Pose3, Point3>,
+              BearingRangeCodec<Pose3, Point3> >(kBearingRange, kPose3);
+    addFactor<GeneralSFMCodec::Factor, GeneralSFMCodec>(kGeneralSFM,
+                                                        kSfMCamera);
+    addFactor<GPSFactor, GPSCodec>(kGPS, kPoint3);
+  }
+
+  const pair<uint64_t, ValueCodec>* value(const Value& value) const {
+    const auto it = valuesByType_.find(typeid(value));
+    return it == valuesByType_.end() ? nullptr : &it->second;
+  }
+  const ValueCodec* value(uint64_t code) const {
+    const auto it = valuesByCode_.find(code);
+    return it == valuesByCode_.end() ? nullptr : &it->second;
+  }
+  const pair<uint64_t, FactorCodec>* factor(const NonlinearFactor& f) const {
+    const auto it = factorsByType_.find(typeid(f));
+    return it == factorsByType_.end() ? nullptr : &it->second;
+  }
+  const FactorCodec* factor(uint64_t code) const {
+    const auto it = factorsByCode_.find(code);
+    return it == factorsByCode_.end() ? nullptr : &it->second;
+  }
+
+ private:
+  /// Register a value type and its PriorFactor
+  template <class T>
+  void addValue(uint64_t code) {
+    const ValueCodec codec = {&ValueCodecs<T>::write, &ValueCodecs<T>::read};
+    valuesByType_.emplace(typeid(GenericValue<T>), make_pair(code, codec));
+    valuesByCode_.emplace(code, codec);
+    addFactor<PriorFactor<T>, PriorCodec<T> >(kPrior, code);
+  }
+
+  template <class T>
+  void addBetween(uint64_t code) {
+    addFactor<BetweenFactor<T>, BetweenCodec<T> >(kBetween, code);
+  }
+
+  template <class FACTOR, class CODEC>
+  void addFactor(uint64_t kind, uint64_t valueType) {
+    const uint64_t code = kind << 8 | valueType;
+    const FactorCodec codec = {&CODEC::write, &CODEC::read};
+    factorsByType_.emplace(typeid(FACTOR), make_pair(code, codec));
+    factorsByCode_.emplace(code, codec);
+  }
+
+  map<type_index, pair<uint64_t, ValueCodec> > valuesByType_;
+  map<uint64_t, ValueCodec> valuesByCode_;
+  map<type_index, pair<uint64_t, FactorCodec> > factorsByType_;
+  map<uint64_t, FactorCodec> factorsByCode_;
+};
+
+const BinaryCodecs& binaryCodecs() {
+  static const BinaryCodecs codecs;
+  return codecs;
+}
+
+/* ************************************************************************* */
+/// Collects the distinct noise models of a graph, identical ones only once
+class BinaryModelTable {
+ public:
+  /// Index of the model in the table, after adding it if it is new
+  uint64_t index(const SharedNoiseModel& model) {
+    const auto known = byPointer_.find(model.get());
+    if (known != byPointer_.end()) return known->second;
+
+    BinaryWriter record;
+    const size_t dim = model->dim();
+    if (auto robust = boost::dynamic_pointer_cast<noiseModel::Robust>(model)) {
+      const uint64_t base = index(robust->noise());
+      record.word(kRobust);
+      record.word(dim);
+      const noiseModel::mEstimator::Base::shared_ptr& kernel = robust->robust();
+      if (auto huber = dynamic_cast<const noiseModel::mEstimator::Huber*>(
+              kernel.get())) {
+        record.word(kHuber);
+        record.number(huber->modelParameter());
+      } else if (auto cauchy =
+                     dynamic_cast<const noiseModel::mEstimator::Cauchy*>(
+                         kernel.get())) {
+        record.word(kCauchy);
+        record.number(cauchy->modelParameter());
+      } else if (auto tukey =
+                     dynamic_cast<const noiseModel::mEstimator::Tukey*>(
+                         kernel.get())) {
+        record.word(kTukey);
+        record.number(tukey->modelParameter());
+      } else {
+        throw invalid_argument(
+            "writeBinaryGraph: unsupported robust kernel");
+      }
+      record.word(kernel->reweightScheme());
+      record.word(base);
+    } else if (dynamic_cast<const noiseModel::Unit*>(model.get())) {
+      record.word(kUnit);
+      record.word(dim);
+    } else if (auto isotropic =
+                   dynamic_cast<const noiseModel::Isotropic*>(model.get())) {
+      record.word(kIsotropic);
+      record.word(dim);
+      record.number(isotropic->sigma());
+    } else if (dynamic_cast<const noiseModel::Constrained*>(model.get())) {
+      throw invalid_argument(
+          "writeBinaryGraph: constrained noise models are not supported");
+    } else if (auto diagonal =
+                   dynamic_cast<const noiseModel::Diagonal*>(model.get())) {
+      record.word(kDiagonal);
+      record.word(dim);
+      record.numbers(diagonal->sigmas());
+    } else if (auto gaussian =
+                   dynamic_cast<const noiseModel::Gaussian*>(model.get())) {
+      record.word(kGaussian);
+      record.word(dim);
+      record.numbers(gaussian->R());
+    } else {
+      throw invalid_argument("writeBinaryGraph: unsupported noise model");
+    }
+
+    const auto inserted = byContents_.emplace(record.words(), byContents_.size());
+    if (inserted.second) {
+      words_.insert(words_.end(), record.words().begin(),
+                    record.words().end());
+    }
+    byPointer_.emplace(model.get(), inserted.first->second);
+    models_.push_back(model);  // keeps the pointer in byPointer_ unique
+    return inserted.first->second;
+  }
+
+  size_t size() const { return byContents_.size(); }
+  const vector<uint64_t>& words() const { return words_; }
+
+ private:
+  map<const noiseModel::Base*, uint64_t> byPointer_;
+  map<vector<uint64_t>, uint64_t> byContents_;
+  vector<SharedNoiseModel> models_;
+  vector<uint64_t> words_;
+};
+
+/// Read a noise model record, written by BinaryModelTable::index
+SharedNoiseModel readBinaryModel(BinaryReader* in,
+                                 const vector<SharedNoiseModel>& models) {
+  const uint64_t kind = in->word();
+  const size_t dim = in->word();
+  switch (kind) {
+    case kUnit:
+      return noiseModel::Unit::Create(dim);
+    case kIsotropic:
+      return noiseModel::Isotropic::Sigma(dim, in->number(), false);
+    case kDiagonal: {
+      Vector sigmas(dim);
+      in->numbers(sigmas);
+      return noiseModel::Diagonal::Sigmas(sigmas, false);
+    }
+    case kGaussian: {
+      Matrix R(dim, dim);
+      in->numbers(R);
+      return noiseModel::Gaussian::SqrtInformation(R, false);
+    }
+    case kRobust: {
+      typedef noiseModel::mEstimator::Base Kernel;
+      const uint64_t type = in->word();
+      const double parameter = in->number();
+      const auto reweight = static_cast<Kernel::ReweightScheme>(in->word());
+      const uint64_t base = in->word();
+      if (base >= models.size())
+        throw invalid_argument("readBinaryGraph: invalid noise model index");
+      Kernel::shared_ptr kernel;
+      if (type == kHuber)
+        kernel = noiseModel::mEstimator::Huber::Create(parameter, reweight);
+      else if (type == kCauchy)
+        kernel = noiseModel::mEstimator::Cauchy::Create(parameter, reweight);
+      else if (type == kTukey)
+        kernel = noiseModel::mEstimator::Tukey::Create(parameter, reweight);
+      else
+        throw invalid_argument("readBinaryGraph: unknown robust kernel");
+      return noiseModel::Robust::Create(kernel, models[base]);
+    }
+    default:
+      throw invalid_argument("readBinaryGraph: unknown noise model");
+  }
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+void writeBinaryGraph(const NonlinearFactorGraph& graph, const Values& values,
+                      ostream& os) {
+  const BinaryCodecs& codecs = binaryCodecs();
+
+  BinaryWriter body;
+  for (const Values::ConstKeyValuePair& key_value : values) {
+    const auto codec = codecs.value(key_value.value);
+    if (!codec)
+      throw invalid_argument(
+          "writeBinaryGraph: unsupported value type " +
+          string(typeid(key_value.value).name()));
+    body.word(key_value.key);
+    body.word(codec->first);
+    codec->second.write(key_value.value, &body);
+  }
+
+  BinaryModelTable models;
+  for (const NonlinearFactor::shared_ptr& factor : graph) {
+    if (!factor) {
+      body.word(kNullFactor);
+      continue;
+    }
+    const auto codec = codecs.factor(*factor);
+    if (!codec)
+      throw invalid_argument("writeBinaryGraph: unsupported factor type " +
+                             string(typeid(*factor).name()));
+    body.word(codec->first);
+    body.word(models.index(
+        static_cast<const NoiseModelFactor&>(*factor).noiseModel()));
+    codec->second.write(*factor, &body);
+  }
+
+  uint64_t header[kBinaryHeaderWords];
+  memcpy(&header[0], kBinaryMagic, sizeof(kBinaryMagic));
+  header[1] = kBinaryVersion;
+  header[2] = kBinaryByteOrder;
+  header[3] = models.size();
+  header[4] = values.size();
+  header[5] = graph.size();
+  os.write(reinterpret_cast<const char*>(header), sizeof(header));
+  os.write(reinterpret_cast<const char*>(models.words().data()),
+           models.words().size() * sizeof(uint64_t));
+  os.write(reinterpret_cast<const char*>(body.words().data()),
+           body.words().size() * sizeof(uint64_t));
+}
+
+/* ************************************************************************* */
+void writeBinaryGraph(const NonlinearFactorGraph& graph, const Values& values,
+                      const string& filename) {
+  ofstream os(filename.c_str(), ios::binary);
+  if (!os)
+    throw invalid_argument("writeBinaryGraph: can not open file " + filename);
+  writeBinaryGraph(graph, values, os);
+}
+
+/* ************************************************************************* */
+GraphAndValues readBinaryGraph(const char* data, size_t size) {
+  BinaryReader in(data, size);
+  uint64_t magic = in.word();
+  if (memcmp(&magic, kBinaryMagic, sizeof(magic)) != 0)
+    throw invalid_argument("readBinaryGraph: not a binary graph");
+  if (in.word() != kBinaryVersion)
+    throw invalid_argument("readBinaryGraph: unsupported version");
+  if (in.word() != kBinaryByteOrder)
+    throw invalid_argument("readBinaryGraph: written with other byte order");
+  const size_t nrModels = in.word(), nrValues = in.word(),
+               nrFactors = in.word();
+
+  vector<SharedNoiseModel> models;
+  models.reserve(nrModels);
+  for (size_t i = 0; i < nrModels; i++)
+    models.push_back(readBinaryModel(&in, models));
+
+  const BinaryCodecs& codecs = binaryCodecs();
+  Values::shared_ptr values(new Values);
+  for (size_t i = 0; i < nrValues; i++) {
+    const Key key = in.word();
+    const ValueCodec* codec = codecs.value(in.word());
+    if (!codec) throw invalid_argument("readBinaryGraph: unknown value type");
+    codec->read(key, &in, values.get());
+  }
+
+  NonlinearFactorGraph::shared_ptr graph(new NonlinearFactorGraph);
+  graph->reserve(nrFactors);
+  for (size_t i = 0; i < nrFactors; i++) {
+    const uint64_t code = in.word();
+    if (code == kNullFactor) {
+      graph->push_back(NonlinearFactor::shared_ptr());
+      continue;
+    }
+    const FactorCodec* codec = codecs.factor(code);
+    if (!codec) throw invalid_argument("readBinaryGraph: unknown factor type");
+    const uint64_t model = in.word();
+    if (model >= models.size())
+      throw invalid_argument("readBinaryGraph: invalid noise model index");
+    graph->push_back(codec->read(&in, models[model]));
+  }
+  return make_pair(graph, values);
+}
+
+/* ************************************************************************* */
+GraphAndValues readBinaryGraph(const string& filename) {
+  MappedFile file;
+  if (!file.open(filename))
+    throw invalid_argument("readBinaryGraph: can not find file " + filename);
+  return readBinaryGraph(file.begin(), file.end() - file.begin());
+}
+
+/* ************************************************************************* */
+void convertG2oToBinary(const string& g2oFile, const string& binaryFile,
+                        bool is3D, KernelFunctionType kernelFunctionType) {
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr values;
+  boost::tie(graph, values) = readG2o(g2oFile, is3D, kernelFunctionType);
+  writeBinaryGraph(*graph, *values, binaryFile);
+}
+
+/* ************************************************************************* */
+bool convertBALToBinary(const string& balFile, const string& binaryFile) {
+  SfM_data data;
+  if (!readBAL(balFile, data)) return false;
+
+  NonlinearFactorGraph graph;
+  const SharedNoiseModel model = noiseModel::Isotropic::Sigma(2, 1.0);
+  for (size_t j = 0; j < data.number_tracks(); j++)
+    for (const SfM_Measurement& m : data.tracks[j].measurements)
+      graph.emplace_shared<GeneralSFMFactor<SfM_Camera, Point3> >(
+          m.second, model, m.first, P(j));
+
+  writeBinaryGraph(graph, initialCamerasAndPointsEstimate(data), binaryFile);
+  return true;
+}
+
 } // \namespace gtsam
@@ -31,6 +31,7 @@
 #include <gtsam/base/types.h>
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <functional>
 #include <string>
 #include <utility> // for pair
 #include <vector>
@@ -165,6 +166,35 @@ GTSAM_EXPORT std::map<Key, Pose3> parse3DPoses(const std::string& filename);
 /// Load TORO 3D Graph
 GTSAM_EXPORT GraphAndValues load3D(const std::string& filename);
 
+/// Receives the factors and values of one chunk of a file, see streamG2o
+typedef std::function<void(const NonlinearFactorGraph& factors,
+                           const Values& values)> GraphChunkCallback;
+
+/**
+ * Read a g2o/TORO pose graph in chunks, without building the complete graph.
+ * The file is memory-mapped and split into chunks of about \c chunkBytes
+ * bytes at line boundaries, which are parsed in parallel when GTSAM is built
+ * with the thread pool, and passed to \c callback one by one, in file order,
+ * from the calling thread.  The callback can, e.g., feed them to ISAM2, or
+ * collect them, as load3D does.
+ *
+ * In 2D, VERTEX_SE2/VERTEX2/VERTEX and EDGE_SE2/EDGE2/EDGE/ODOMETRY lines are
+ * read as in readG2o, with the information matrix of the edges in g2o order.
+ * In 3D, VERTEX3/VERTEX_SE3:QUAT and EDGE3/EDGE_SE3:QUAT lines are read as in
+ * load3D.  Other lines are skipped; unlike load2D, poses are not initialized
+ * from odometry edges.  If a vertex appears more than once, every occurrence
+ * is passed on with its chunk.
+ * @param filename the g2o file
+ * @param callback called with the factors and vertices of every chunk
+ * @param is3D whether the file describes a 2D or 3D problem
+ * @param kernelFunctionType whether to wrap the noise models in a robust kernel
+ * @param chunkBytes approximate size of the chunks
+ */
+GTSAM_EXPORT void streamG2o(const std::string& filename,
+    const GraphChunkCallback& callback, bool is3D = false,
+    KernelFunctionType kernelFunctionType = KernelFunctionTypeNONE,
+    size_t chunkBytes = 1 << 22);
+
 /// A measurement with its camera index
 typedef std::pair<size_t, Point2> SfM_Measurement;
 
@@ -280,4 +310,48 @@ GTSAM_EXPORT Values initialCamerasEstimate(const SfM_data& db);
  */
 GTSAM_EXPORT Values initialCamerasAndPointsEstimate(const SfM_data& db);
 
+/**
+ * Write a factor graph and values in the binary graph format, a compact
+ * alternative to the text formats and to Boost serialization.  The file is a
+ * header followed by noise models, values and factors, all stored as 8-byte
+ * words in native byte order, such that it can be read back from a memory
+ * mapping without parsing.  Identical noise models are stored once.
+ *
+ * Supported values are Pose2, Pose3, Point2, Point3, Rot2, Rot3, Vector3,
+ * Vector, imuBias::ConstantBias, NavState, Cal3Bundler and SfM_Camera.
+ * Supported factors are PriorFactor on any of these, BetweenFactor on the
+ * Lie groups and Vector3, BearingRangeFactor<Pose2, Point2> and <Pose3,
+ * Point3>, GeneralSFMFactor<SfM_Camera, Point3> and GPSFactor, with unit,
+ * isotropic, diagonal, Gaussian and Huber/Cauchy/Tukey robust noise models.
+ * Null factors are kept, such that factor indices are preserved.  Anything
+ * else throws std::invalid_argument.
+ */
+GTSAM_EXPORT void writeBinaryGraph(const NonlinearFactorGraph& graph,
+                                   const Values& values, std::ostream& os);
+
+/// Write a factor graph and values to a file in the binary graph format
+GTSAM_EXPORT void writeBinaryGraph(const NonlinearFactorGraph& graph,
+                                   const Values& values,
+                                   const std::string& filename);
+
+/// Read a graph written by writeBinaryGraph from \c size bytes at \c data
+GTSAM_EXPORT GraphAndValues readBinaryGraph(const char* data, size_t size);
+
+/// Memory-map and read a file written by writeBinaryGraph
+GTSAM_EXPORT GraphAndValues readBinaryGraph(const std::string& filename);
+
+/// Convert a g2o file, read with readG2o, to the binary graph format
+GTSAM_EXPORT void convertG2oToBinary(const std::string& g2oFile,
+    const std::string& binaryFile, bool is3D = false,
+    KernelFunctionType kernelFunctionType = KernelFunctionTypeNONE);
+
+/**
+ * Convert a BAL file to the binary graph format: a GeneralSFMFactor with unit
+ * pixel noise per measurement, and initial values for camera i with key i and
+ * for point j with key P(j), as in writeBALfromValues.
+ * @return false if the BAL file can not be read
+ */
+GTSAM_EXPORT bool convertBALToBinary(const std::string& balFile,
+                                     const std::string& binaryFile);
+
 } // namespace gtsam
@@ -44,6 +44,23 @@ TEST(BetweenFactor, Rot3) {
   EXPECT(assert_equal(numericalH2,actualH2, 1E-5));
 }
 
+/* ************************************************************************* */
+TEST(BetweenFactor, linearizeFixed) {
+  BetweenFactor<Rot3> factor(R(1), R(2), Rot3::Rodrigues(0.3, 0.3, 0.3),
+                             Isotropic::Sigma(3, 0.05));
+  Values values;
+  values.insert(R(1), Rot3::Rodrigues(0.1, 0.2, 0.3));
+  values.insert(R(2), Rot3::Rodrigues(0.4, 0.5, 0.6));
+
+  // Same as the dynamic-size linearization, but with a fixed-size type
+  const GaussianFactor::shared_ptr expected =
+      factor.NoiseModelFactor::linearize(values);
+  const GaussianFactor::shared_ptr actual = factor.linearize(values);
+  typedef FixedJacobianFactor<3, 3, 3> Fixed;
+  CHECK(boost::dynamic_pointer_cast<Fixed>(actual));
+  EXPECT(assert_equal(*expected, *actual, 1e-9));
+}
+
 /* ************************************************************************* */
 /*
 // Constructor scalar
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testBetweenFactorBatch.cpp
+ * @brief   Unit tests for BetweenFactorBatch
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/slam/BetweenFactorBatch.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// A chain of poses with loop closures, with the noise models readG2o creates
+// and some factors the batch has to leave alone
+static NonlinearFactorGraph createGraph(Values* values) {
+  NonlinearFactorGraph graph;
+  const SharedNoiseModel isotropic = noiseModel::Isotropic::Sigma(6, 0.1);
+  const SharedNoiseModel diagonal =
+      noiseModel::Diagonal::Sigmas((Vector(6) << 0.1, 0.2, 0.1, 1, 2, 1).finished());
+  Matrix6 information = Matrix6::Identity() * 4;
+  information(0, 3) = information(3, 0) = 1;
+  const SharedNoiseModel gaussian = noiseModel::Gaussian::Information(information);
+  const SharedNoiseModel robust = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Huber::Create(1.0), isotropic);
+
+  graph.emplace_shared<PriorFactor<Pose3> >(0, Pose3(), isotropic);
+  const SharedNoiseModel models[] = {isotropic, diagonal, gaussian};
+  const Pose3 odometry(Rot3::Ypr(0.3, 0.1, -0.1), Point3(1, 0.2, 0));
+  for (size_t i = 0; i < 20; ++i) {
+    values->insert(i, Pose3(Rot3::Ypr(0.3 * i, 0.1 * sin(i), 0.05 * i),
+                            Point3(cos(0.3 * i), sin(0.3 * i), 0.01 * i)));
+    if (i > 0)
+      graph.emplace_shared<BetweenFactor<Pose3> >(i - 1, i, odometry,
+                                                  models[i % 3]);
+    if (i >= 5 && i % 5 == 0)
+      graph.emplace_shared<BetweenFactor<Pose3> >(i - 5, i, odometry * odometry,
+                                                  isotropic);
+  }
+  graph.emplace_shared<BetweenFactor<Pose3> >(3, 17, odometry, robust);
+  graph.push_back(NonlinearFactor::shared_ptr());
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, Pose3) {
+  Values values;
+  const NonlinearFactorGraph graph = createGraph(&values);
+  const auto batch = boost::make_shared<BetweenFactorBatch<Pose3> >(graph);
+
+  // 19 odometry factors and 3 loop closures, not the prior and robust factor
+  EXPECT_LONGS_EQUAL(22, batch->size());
+  EXPECT_LONGS_EQUAL(20, batch->keys().size());
+  EXPECT_LONGS_EQUAL(1, batch->indices().front());
+
+  const FactorBatches batches{batch};
+  EXPECT_DOUBLES_EQUAL(graph.error(values), graph.error(values, batches), 1e-9);
+  const GaussianFactorGraph::shared_ptr expected = graph.linearize(values);
+  const GaussianFactorGraph::shared_ptr actual = graph.linearize(values, batches);
+  EXPECT(assert_equal(*expected, *actual, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, Pose2) {
+  NonlinearFactorGraph graph;
+  Values values;
+  const SharedNoiseModel model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  for (size_t i = 0; i < 5; ++i) {
+    values.insert(i, Pose2(i + 0.1, 0.2 * i, 0.1 * i));
+    if (i > 0)
+      graph.emplace_shared<BetweenFactor<Pose2> >(i - 1, i, Pose2(1, 0, 0), model);
+  }
+  // A batch of another value type does not cover any factor
+  const FactorBatches batches{boost::make_shared<BetweenFactorBatch<Pose2> >(graph),
+                              boost::make_shared<BetweenFactorBatch<Pose3> >(graph)};
+  EXPECT_LONGS_EQUAL(4, batches[0]->size());
+  EXPECT_LONGS_EQUAL(0, batches[1]->size());
+  EXPECT_DOUBLES_EQUAL(graph.error(values), graph.error(values, batches), 1e-9);
+  EXPECT(assert_equal(*graph.linearize(values), *graph.linearize(values, batches),
+                      1e-9));
+
+  // Overlapping batches are rejected
+  const FactorBatches twice{batches[0], batches[0]};
+  CHECK_EXCEPTION(graph.linearize(values, twice), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -18,6 +18,11 @@
 
 #include <gtsam/slam/dataset.h>
 #include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/GeneralSFMFactor.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/sam/BearingRangeFactor.h>
+#include <gtsam/navigation/GPSFactor.h>
+#include <gtsam/navigation/ImuBias.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/base/TestableAssertions.h>
@@ -232,6 +237,50 @@ TEST(dataSet, readG2o3D) {
   }
 }
 
+/* ************************************************************************* */
+TEST(dataSet, streamG2o) {
+  // Tiny chunks, such that every chunk holds a line or two
+  const size_t chunkBytes = 64;
+  size_t nrChunks = 0;
+  NonlinearFactorGraph graph;
+  Values values;
+  auto collect = [&](const NonlinearFactorGraph& factors, const Values& poses) {
+    ++nrChunks;
+    graph.push_back(factors);
+    values.insert(poses);
+  };
+
+  const string g2oFile = findExampleDataFile("pose2example");
+  streamG2o(g2oFile, collect, false, KernelFunctionTypeNONE, chunkBytes);
+  EXPECT(nrChunks > 1);
+  NonlinearFactorGraph::shared_ptr expectedGraph;
+  Values::shared_ptr expectedValues;
+  boost::tie(expectedGraph, expectedValues) = readG2o(g2oFile);
+  EXPECT(assert_equal(*expectedGraph, graph, 1e-9));
+  EXPECT(assert_equal(*expectedValues, values, 1e-9));
+
+  // 3D, against the sequential parsers
+  nrChunks = 0;
+  graph = NonlinearFactorGraph();
+  values.clear();
+  const string g2o3DFile = findExampleDataFile("pose3example");
+  const bool is3D = true;
+  streamG2o(g2o3DFile, collect, is3D, KernelFunctionTypeNONE, chunkBytes);
+  EXPECT(nrChunks > 1);
+  const auto factors = parse3DFactors(g2o3DFile);
+  LONGS_EQUAL(factors.size(), graph.size());
+  for (size_t i = 0; i < factors.size(); i++)
+    EXPECT(assert_equal(
+        *factors[i],
+        *boost::dynamic_pointer_cast<BetweenFactor<Pose3>>(graph[i]), 1e-9));
+  const auto poses = parse3DPoses(g2o3DFile);
+  LONGS_EQUAL(poses.size(), values.size());
+  for (const auto& key_pose : poses)
+    EXPECT(assert_equal(key_pose.second, values.at<Pose3>(key_pose.first), 1e-9));
+
+  CHECK_EXCEPTION(streamG2o("no-such-file.g2o", collect), invalid_argument);
+}
+
 /* ************************************************************************* */
 TEST( dataSet, readG2o3DNonDiagonalNoise)
 {
@@ -384,6 +433,102 @@ TEST( dataSet, writeG2o3DNonDiagonalNoise)
   EXPECT(assert_equal(*expectedGraph,*actualGraph,1e-4));
 }
 
+/* ************************************************************************* */
+TEST(dataSet, binaryGraph) {
+  // One factor of every kind, with every kind of noise model
+  NonlinearFactorGraph graph;
+  Values values;
+  const auto unit = noiseModel::Unit::Create(3);
+  const auto isotropic = noiseModel::Isotropic::Sigma(6, 0.1);
+  const auto diagonal = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.2, 0.3));
+  Matrix3 R;
+  R << 2, 1, 0, 0, 3, 1, 0, 0, 4;
+  const auto gaussian = noiseModel::Gaussian::SqrtInformation(R);
+  const auto robust = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Huber::Create(1.5), isotropic);
+
+  const Pose3 pose(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3));
+  values.insert(0, Pose2(1, 2, 0.3));
+  values.insert(1, Pose2(2, 2, 0.5));
+  values.insert(2, Point2(4, 5));
+  values.insert(3, pose);
+  values.insert(4, pose.compose(pose));
+  values.insert(5, Point3(7, 8, 9));
+  values.insert(6, Vector3(0.1, 0.2, 0.3));
+  values.insert(7, imuBias::ConstantBias(Vector3(1, 2, 3), Vector3(4, 5, 6)));
+  values.insert(8, NavState(pose, Vector3(1, 0, 0)));
+  values.insert(9, SfM_Camera(pose, Cal3Bundler(500, 0.1, 0.01)));
+  values.insert(10, (Vector(2) << 1, 2).finished());
+
+  graph.emplace_shared<PriorFactor<Pose2> >(0, Pose2(1, 2, 0.3), unit);
+  graph.emplace_shared<BetweenFactor<Pose2> >(0, 1, Pose2(1, 0, 0.2), diagonal);
+  graph.emplace_shared<BetweenFactor<Pose2> >(0, 1, Pose2(1, 0, 0.2), gaussian);
+  graph.emplace_shared<BearingRangeFactor<Pose2, Point2> >(
+      1, 2, Rot2(0.5), 3.0, noiseModel::Isotropic::Sigma(2, 0.1));
+  graph.push_back(NonlinearFactor::shared_ptr());
+  graph.emplace_shared<BetweenFactor<Pose3> >(3, 4, pose, robust);
+  graph.emplace_shared<BetweenFactor<Pose3> >(3, 4, pose, isotropic);
+  graph.emplace_shared<BearingRangeFactor<Pose3, Point3> >(
+      3, 5, Unit3(1, 1, 0), 3.0, noiseModel::Isotropic::Sigma(3, 0.1));
+  graph.emplace_shared<PriorFactor<Vector3> >(6, Vector3(0, 0, 0), unit);
+  graph.emplace_shared<BetweenFactor<imuBias::ConstantBias> >(
+      7, 7, imuBias::ConstantBias(), isotropic);
+  graph.emplace_shared<PriorFactor<NavState> >(
+      8, NavState(), noiseModel::Isotropic::Sigma(9, 0.1));
+  graph.emplace_shared<GeneralSFMFactor<SfM_Camera, Point3> >(
+      Point2(1, 2), noiseModel::Unit::Create(2), 9, 5);
+  graph.emplace_shared<GPSFactor>(3, Point3(1, 2, 3), unit);
+
+  stringstream stream;
+  writeBinaryGraph(graph, values, stream);
+  const string data = stream.str();
+  NonlinearFactorGraph::shared_ptr actualGraph;
+  Values::shared_ptr actualValues;
+  boost::tie(actualGraph, actualValues) =
+      readBinaryGraph(data.data(), data.size());
+  EXPECT(assert_equal(values, *actualValues, 1e-12));
+  EXPECT(assert_equal(graph, *actualGraph, 1e-12));
+
+  // The isotropic model is stored once, though used by three factors
+  const auto between =
+      boost::dynamic_pointer_cast<NoiseModelFactor>(actualGraph->at(6));
+  const auto bias =
+      boost::dynamic_pointer_cast<NoiseModelFactor>(actualGraph->at(9));
+  EXPECT(between->noiseModel() == bias->noiseModel());
+
+  // Truncated data, and unsupported factors, are rejected
+  CHECK_EXCEPTION(readBinaryGraph(data.data(), data.size() / 2),
+                  invalid_argument);
+  NonlinearFactorGraph unsupported;
+  unsupported.emplace_shared<PriorFactor<Pose2> >(
+      0, Pose2(), noiseModel::Constrained::All(3));
+  CHECK_EXCEPTION(writeBinaryGraph(unsupported, values, stream),
+                  invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(dataSet, convertToBinary) {
+  const string g2oFile = findExampleDataFile("pose3example-offdiagonal");
+  const string binaryFile = createRewrittenFileName(g2oFile);
+  const bool is3D = true;
+  convertG2oToBinary(g2oFile, binaryFile, is3D);
+  NonlinearFactorGraph::shared_ptr expectedGraph, actualGraph;
+  Values::shared_ptr expectedValues, actualValues;
+  boost::tie(expectedGraph, expectedValues) = readG2o(g2oFile, is3D);
+  boost::tie(actualGraph, actualValues) = readBinaryGraph(binaryFile);
+  EXPECT(assert_equal(*expectedValues, *actualValues, 1e-12));
+  EXPECT(assert_equal(*expectedGraph, *actualGraph, 1e-12));
+
+  const string balFile = findExampleDataFile("dubrovnik-3-7-pre");
+  const string balBinaryFile = createRewrittenFileName(balFile);
+  EXPECT(convertBALToBinary(balFile, balBinaryFile));
+  SfM_data db;
+  EXPECT(readBAL(balFile, db));
+  boost::tie(actualGraph, actualValues) = readBinaryGraph(balBinaryFile);
+  EXPECT(assert_equal(initialCamerasAndPointsEstimate(db), *actualValues));
+  LONGS_EQUAL(19, actualGraph->size());  // one factor per observation
+}
+
 /* ************************************************************************* */
 TEST( dataSet, readBAL_Dubrovnik)
 {
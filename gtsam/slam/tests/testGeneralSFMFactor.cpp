@@ -380,6 +380,48 @@ TEST( GeneralSFMFactor, optimize_varK_BA ) {
   EXPECT(optimizer.error() < 0.5 * reproj_error * nMeasurements);
 }
 
+/* ************************************************************************* */
+TEST( GeneralSFMFactor, optimize_SchurComplement ) {
+  vector<Point3> landmarks = genPoint3();
+  vector<GeneralCamera> cameras = genCameraVariableCalibration();
+
+  Graph graph;
+  for (size_t j = 0; j < cameras.size(); ++j) {
+    for (size_t i = 0; i < landmarks.size(); ++i) {
+      Point2 pt = cameras[j].project(landmarks[i]);
+      graph.addMeasurement(j, i, pt, sigma1);
+    }
+  }
+  const size_t nMeasurements = cameras.size() * landmarks.size();
+
+  const double noise = baseline * 0.1;
+  Values values;
+  for (size_t i = 0; i < cameras.size(); ++i)
+    values.insert(X(i), cameras[i]);
+  for (size_t i = 0; i < landmarks.size(); ++i) {
+    Point3 pt(landmarks[i].x() + noise * getGaussian(),
+        landmarks[i].y() + noise * getGaussian(),
+        landmarks[i].z() + noise * getGaussian());
+    values.insert(L(i), pt);
+  }
+  graph.addCameraConstraint(0, cameras[0]);
+  graph.emplace_shared<
+      RangeFactor<GeneralCamera, GeneralCamera> >(X(0), X(1), 2.,
+          noiseModel::Isotropic::Sigma(1, 10.));
+
+  // The landmarks are eliminated in closed form, with the same result as the
+  // generic elimination
+  LevenbergMarquardtParams params;
+  params.setOrdering(*getOrdering(cameras, landmarks));
+  LevenbergMarquardtOptimizer expected(graph, values, params);
+  expected.optimize();
+  params.linearSolverType = NonlinearOptimizerParams::SCHUR_COMPLEMENT;
+  LevenbergMarquardtOptimizer actual(graph, values, params);
+  actual.optimize();
+  EXPECT(actual.error() < 0.5 * 1e-5 * nMeasurements);
+  EXPECT(assert_equal(expected.values(), actual.values(), 1e-5));
+}
+
 /* ************************************************************************* */
 TEST(GeneralSFMFactor, GeneralCameraPoseRange) {
   // Tests range factor between a GeneralCamera and a Pose3
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testRegularImplicitSchurBatch.cpp
+ * @brief   Unit tests for RegularImplicitSchurBatch
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/slam/RegularImplicitSchurBatch.h>
+#include <gtsam/geometry/CalibratedCamera.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+
+typedef RegularImplicitSchurFactor<CalibratedCamera> Implicit;
+typedef RegularImplicitSchurBatch<CalibratedCamera> Batch;
+
+static const size_t M = 8;  // number of cameras
+
+/* ************************************************************************* */
+// A factor on cameras first, first+step, ... with deterministic blocks
+static boost::shared_ptr<Implicit> createFactor(size_t seed, size_t m,
+                                                size_t first, size_t step) {
+  KeyVector keys;
+  vector<Matrix26, Eigen::aligned_allocator<Matrix26> > FBlocks;
+  Matrix E(2 * m, 3);
+  for (size_t k = 0; k < m; ++k) {
+    keys.push_back((first + k * step) % M);
+    Matrix26 F;
+    for (int r = 0; r < 2; ++r)
+      for (int c = 0; c < 6; ++c) F(r, c) = sin(seed + 7.0 * k + 3.0 * r + c);
+    FBlocks.push_back(F);
+    for (int r = 0; r < 2; ++r)
+      for (int c = 0; c < 3; ++c)
+        E(2 * k + r, c) = cos(seed + 5.0 * k + 2.0 * r + c) + (r == c ? 2 : 0);
+  }
+  const Matrix3 P = (E.transpose() * E).inverse();
+  return boost::make_shared<Implicit>(keys, FBlocks, E, P, Vector::Zero(2 * m));
+}
+
+/* ************************************************************************* */
+static GaussianFactorGraph createGraph() {
+  GaussianFactorGraph graph;
+  graph.push_back(createFactor(1, 3, 0, 1));
+  graph.push_back(createFactor(2, 4, 2, 3));
+  // Not an implicit Schur factor, skipped by the batch
+  graph.emplace_shared<JacobianFactor>(0, Matrix::Identity(6, 6),
+                                       Vector::Zero(6));
+  graph.push_back(createFactor(3, 2, 7, 2));
+  // More cameras than fit in the stack buffer, i.e., cameras seen many times
+  graph.push_back(createFactor(4, 70, 5, 1));
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(RegularImplicitSchurBatch, multiplyHessianAdd) {
+  const GaussianFactorGraph graph = createGraph();
+  Batch batch(graph);
+  EXPECT_LONGS_EQUAL(4, batch.size());
+  EXPECT_LONGS_EQUAL(3 + 4 + 2 + 70, batch.numMeasurements());
+  EXPECT_LONGS_EQUAL(M, batch.keys().size());
+
+  VectorValues x, y;
+  for (Key j = 0; j < M; ++j) {
+    x.insert(j, (Vector(6) << 1, -2, 3, j, 0.5, -1.0 * j).finished());
+    y.insert(j, Vector::Constant(6, 1.0));
+  }
+  const double alpha = 0.5;
+
+  // Sum of the products of the individual factors
+  VectorValues expected = y;
+  for (const auto& factor : graph)
+    if (auto implicit = boost::dynamic_pointer_cast<Implicit>(factor))
+      implicit->multiplyHessianAdd(alpha, x, expected);
+
+  VectorValues actual = y;
+  batch.multiplyHessianAdd(alpha, x, actual);
+  EXPECT(assert_equal(expected, actual, 1e-9));
+
+  // Cameras not yet in y are inserted
+  VectorValues inserted;
+  batch.multiplyHessianAdd(alpha, x, inserted);
+  EXPECT(assert_equal(expected - y, inserted, 1e-9));
+
+  // Raw memory version
+  Vector xRaw = x.vector(), yRaw = y.vector();
+  batch.multiplyHessianAdd(alpha, xRaw.data(), yRaw.data());
+  EXPECT(assert_equal(expected.vector(), yRaw, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(RegularImplicitSchurBatch, PCGSolver) {
+  // Priors on all cameras make the system positive definite
+  GaussianFactorGraph graph = createGraph();
+  for (Key j = 0; j < M; ++j)
+    graph.emplace_shared<JacobianFactor>(j, Matrix::Identity(6, 6),
+                                         Vector::Constant(6, 1.0 + j));
+  EXPECT(!Batch::Create(GaussianFactorGraph()));
+
+  // The system multiplies the factors not in the batch one by one
+  const KeyInfo keyInfo(graph);
+  const map<Key, Vector> lambda;
+  DummyPreconditioner preconditioner;
+  const GaussianFactorGraphSystem expected(graph, preconditioner, keyInfo, lambda);
+  const GaussianFactorGraphSystem actual(graph, preconditioner, keyInfo, lambda,
+                                         Batch::Create(graph));
+  EXPECT_LONGS_EQUAL(M + 1, actual.others_->size());
+  Vector x(6 * M), expectedAx(6 * M), actualAx(6 * M);
+  for (size_t i = 0; i < 6 * M; ++i) x(i) = sin(1.0 + i);
+  expected.multiply(x, expectedAx);
+  actual.multiply(x, actualAx);
+  EXPECT(assert_equal(expectedAx, actualAx, 1e-9));
+
+  // Solving with the batch gives the same solution
+  PCGSolverParameters parameters;
+  parameters.preconditioner_ = boost::make_shared<DummyPreconditionerParameters>();
+  parameters.setEpsilon_abs(1e-12);
+  parameters.setEpsilon_rel(1e-12);
+  parameters.setMaxIterations(500);
+  const VectorValues initial = keyInfo.x0();
+  const VectorValues unbatched =
+      PCGSolver(parameters).optimize(graph, keyInfo, lambda, initial);
+  parameters.hessianBatch_ = &Batch::Create;
+  const VectorValues batched =
+      PCGSolver(parameters).optimize(graph, keyInfo, lambda, initial);
+  EXPECT(assert_equal(unbatched, batched, 1e-6));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
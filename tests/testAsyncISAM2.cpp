@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testAsyncISAM2.cpp
+ * @brief   Unit tests for AsyncISAM2
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/nonlinear/AsyncISAM2.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::X;
+
+static const SharedNoiseModel model = noiseModel::Isotropic::Sigma(3, 0.1);
+
+/* ************************************************************************* */
+TEST(AsyncISAM2, circle) {
+  ISAM2Params params;
+  params.relinearizeThreshold = 0.0;
+  params.relinearizeSkip = 3;
+  AsyncISAM2 async(params);
+  ISAM2 isam(params);
+
+  NonlinearFactorGraph fullgraph;
+  Values fullinit;
+  const Pose2 odometry(0.5, 0.0, M_PI / 8);
+  for (size_t i = 0; i < 20; ++i) {
+    NonlinearFactorGraph newFactors;
+    Values newTheta;
+    if (i == 0) {
+      newFactors.emplace_shared<PriorFactor<Pose2> >(X(0), Pose2(), model);
+      newTheta.insert(X(0), Pose2(0.01, -0.01, 0.01));
+    } else {
+      newFactors.emplace_shared<BetweenFactor<Pose2> >(X(i - 1), X(i), odometry,
+                                                      model);
+      // Sixteen odometry steps close the circle
+      if (i >= 16)
+        newFactors.emplace_shared<BetweenFactor<Pose2> >(X(i - 16), X(i),
+                                                        Pose2(), model);
+      // Initialize from the estimate, with a perturbation
+      Pose2 previous = async.calculateEstimate<Pose2>(X(i - 1));
+      newTheta.insert(X(i), previous * odometry * Pose2(0.05, 0.05, 0.05));
+    }
+    fullgraph.push_back(newFactors);
+    fullinit.insert(newTheta);
+
+    // Factor indices are the same as those of a regular ISAM2
+    ISAM2Result actual = async.update(newFactors, newTheta);
+    ISAM2Result expected = isam.update(newFactors, newTheta);
+    EXPECT(expected.newFactorsIndices == actual.newFactorsIndices);
+  }
+  EXPECT(async.nrRelinearizations() + async.relinearizing() > 0);
+
+  // Relinearizing until convergence gives the batch solution
+  for (size_t k = 0; k < 4; ++k) async.waitForRelinearization();
+  EXPECT(!async.relinearizing());
+  Values expected = LevenbergMarquardtOptimizer(fullgraph, fullinit).optimize();
+  EXPECT(assert_equal(expected, async.calculateEstimate(), 1e-5));
+  EXPECT(assert_equal(fullgraph, async.isam().getFactorsUnsafe()));
+
+  // The foreground ISAM2 never relinearizes by itself
+  EXPECT(!async.isam().params().enableRelinearization);
+}
+
+/* ************************************************************************* */
+TEST(AsyncISAM2, removeFactorsAfterSwap) {
+  ISAM2Params params;
+  params.relinearizeSkip = 1;
+  AsyncISAM2 async(params);
+
+  NonlinearFactorGraph graph;
+  graph.emplace_shared<PriorFactor<Pose2> >(X(0), Pose2(), model);
+  graph.emplace_shared<BetweenFactor<Pose2> >(X(0), X(1), Pose2(1, 0, 0), model);
+  Values init;
+  init.insert(X(0), Pose2(0.1, 0.1, 0.1));
+  init.insert(X(1), Pose2(1.1, -0.1, 0.0));
+  async.update(graph, init);
+
+  // A second odometry factor, added while relinearizing, then removed
+  NonlinearFactorGraph extra;
+  extra.emplace_shared<BetweenFactor<Pose2> >(X(0), X(1), Pose2(2, 0, 0), model);
+  ISAM2Result result = async.update(extra);
+  async.waitForRelinearization();
+
+  ISAM2UpdateParams updateParams;
+  updateParams.removeFactorIndices = result.newFactorsIndices;
+  async.update(NonlinearFactorGraph(), Values(), updateParams);
+  for (size_t k = 0; k < 3; ++k) async.waitForRelinearization();
+
+  EXPECT(assert_equal(Pose2(1, 0, 0), async.calculateEstimate<Pose2>(X(1)),
+                      1e-6));
+}
+
+/* ************************************************************************* */
+TEST(AsyncISAM2, forceRelinearize) {
+  ISAM2Params params;
+  params.enableRelinearization = false;
+  AsyncISAM2 async(params);
+
+  NonlinearFactorGraph graph;
+  graph.emplace_shared<PriorFactor<Pose2> >(X(0), Pose2(), model);
+  graph.emplace_shared<BetweenFactor<Pose2> >(X(0), X(1), Pose2(1, 0, 0), model);
+  Values init;
+  init.insert(X(0), Pose2(0.1, 0.1, 0.1));
+  init.insert(X(1), Pose2(1.1, -0.1, 0.3));
+
+  // Without relinearization enabled, nothing runs in the background
+  async.update(graph, init);
+  EXPECT(!async.relinearizing());
+
+  // Forcing starts a relinearization, as ISAM2 would relinearize
+  ISAM2UpdateParams force;
+  force.force_relinearize = true;
+  async.update(NonlinearFactorGraph(), Values(), force);
+  EXPECT(async.relinearizing());
+
+  // Forcing again runs a second relinearization that includes this update:
+  // right away if the first one is done, otherwise queued until it is swapped
+  // in by the next update
+  NonlinearFactorGraph extra;
+  extra.emplace_shared<BetweenFactor<Pose2> >(X(1), X(2), Pose2(1, 0, 0), model);
+  Values extraInit;
+  extraInit.insert(X(2), Pose2(2.2, 0.2, -0.3));
+  async.update(extra, extraInit, force);
+  async.waitForRelinearization();
+  async.update();
+  EXPECT_LONGS_EQUAL(2, async.nrRelinearizations() + async.relinearizing());
+  for (size_t k = 0; k < 3; ++k) async.waitForRelinearization();
+
+  EXPECT(assert_equal(Pose2(2, 0, 0), async.calculateEstimate<Pose2>(X(2)),
+                      1e-6));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
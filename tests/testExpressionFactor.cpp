@@ -21,6 +21,7 @@
 #include <gtsam/slam/GeneralSFMFactor.h>
 #include <gtsam/slam/ProjectionFactor.h>
 #include <gtsam/slam/PriorFactor.h>
+#include <gtsam/sam/RangeFactor.h>
 #include <gtsam/nonlinear/expressionTesting.h>
 #include <gtsam/nonlinear/ExpressionFactor.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
@@ -630,6 +631,39 @@ TEST(ExpressionFactor, MultiplyWithInverseFunction) {
   EXPECT_CORRECT_FACTOR_JACOBIANS(factor, values, 1e-5, 1e-5);
 }
 
+/* ************************************************************************* */
+// Linearization on the stack, compared to the generic NoiseModelFactor one
+TEST(ExpressionFactor, FixedSize) {
+  Values values;
+  values.insert(1, Pose3(Rot3::Ypr(0.1, -0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(2, Pose3(Rot3::Ypr(-0.3, 0.2, 0.1), Point3(-1, 0, 4)));
+  values.insert(3, Point3(0.5, 0.5, 5));
+
+  // Unit, diagonal, full Gaussian and robust noise models
+  Matrix22 covariance;
+  covariance << 0.04, 0.01, 0.01, 0.09;
+  const vector<SharedNoiseModel> models{
+      noiseModel::Unit::Create(2), noiseModel::Diagonal::Sigmas(Vector2(0.1, 2)),
+      noiseModel::Gaussian::Covariance(covariance),
+      noiseModel::Robust::Create(noiseModel::mEstimator::Huber::Create(1.0),
+                                 noiseModel::Isotropic::Sigma(2, 0.5))};
+  const Point2_ projection(Project, transformTo(Pose3_(1), Point3_(3)));
+  for (const SharedNoiseModel& model : models) {
+    ExpressionFactor<Point2> f(model, measured, projection);
+    EXPECT(assert_equal(*f.NoiseModelFactor::linearize(values),
+                        *f.linearize(values), 1e-9));
+  }
+
+  // Binary factors with arguments of the same dimension are regular
+  RangeFactor<Pose3, Pose3> range(1, 2, 3.0, noiseModel::Isotropic::Sigma(1, 0.1));
+  const GaussianFactor::shared_ptr actual = range.linearize(values);
+  EXPECT(boost::dynamic_pointer_cast<RegularJacobianFactor<6> >(actual));
+  EXPECT(assert_equal(*range.NoiseModelFactor::linearize(values), *actual, 1e-9));
+  RangeFactor<Pose3, Point3> range2(1, 3, 3.0, noiseModel::Unit::Create(1));
+  EXPECT(assert_equal(*range2.NoiseModelFactor::linearize(values),
+                      *range2.linearize(values), 1e-9));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
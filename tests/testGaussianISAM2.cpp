@@ -19,6 +19,7 @@
 #include <gtsam/linear/GaussianBayesTree.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/inference/Ordering.h>
+#include <gtsam/inference/Symbol.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/TestableAssertions.h>
 #include <gtsam/base/treeTraversal-inst.h>
@@ -619,6 +620,117 @@ TEST(ISAM2, slamlike_solution_partial_relinearization_check)
   CHECK(isam_check(fullgraph, fullinit, isam, *this, result_));
 }
 
+/* ************************************************************************* */
+TEST(ISAM2, slamlike_solution_numThreads)
+{
+  // Serial and parallel updates give the same result, with and without
+  // wildfire, and with relinearization of only some variables
+  for (double wildfireThreshold : {0.0, 0.001}) {
+    ISAM2Params params(ISAM2GaussNewtonParams(wildfireThreshold), 0.01, 1, true);
+    params.numThreads = 1;
+    ISAM2 serial = createSlamlikeISAM2(boost::none, boost::none, params);
+
+    params.numThreads = 4;
+    ISAM2 parallel = createSlamlikeISAM2(boost::none, boost::none, params);
+
+    EXPECT(assert_equal(serial.getLinearizationPoint(),
+                        parallel.getLinearizationPoint()));
+    EXPECT(assert_equal(serial.getDelta(), parallel.getDelta()));
+    EXPECT(assert_equal(serial.calculateEstimate(), parallel.calculateEstimate()));
+  }
+}
+
+/* ************************************************************************* */
+TEST(ISAM2, deadline)
+{
+  // Relinearize only when forced, so that deltas accumulate
+  ISAM2Params params(ISAM2GaussNewtonParams(0.0), 0.001, 1000, true);
+  ISAM2 isam = createSlamlikeISAM2(boost::none, boost::none, params);
+
+  KeySet aboveThreshold;
+  for (const VectorValues::KeyValuePair& key_delta : isam.getDelta())
+    if (key_delta.second.lpNorm<Eigen::Infinity>() >= 0.001)
+      aboveThreshold.insert(key_delta.first);
+  CHECK(!aboveThreshold.empty());
+
+  ISAM2UpdateParams updateParams;
+  updateParams.force_relinearize = true;
+
+  // With an ample budget, nothing is deferred
+  ISAM2 ample(isam);
+  updateParams.deadline = 1000.0;
+  ISAM2Result result = ample.update(NonlinearFactorGraph(), Values(), updateParams);
+  EXPECT(result.deferredRelinKeys.empty());
+  EXPECT(result.variablesRelinearized >= aboveThreshold.size());
+
+  // Without any time left, all relinearizations are deferred
+  updateParams.deadline = 0.0;
+  result = isam.update(NonlinearFactorGraph(), Values(), updateParams);
+  EXPECT(aboveThreshold == result.deferredRelinKeys);
+  LONGS_EQUAL(0, result.variablesRelinearized);
+
+  // and done in the next update, even though relinearizeSkip did not fire
+  result = isam.update();
+  EXPECT(result.deferredRelinKeys.empty());
+  EXPECT(result.variablesRelinearized >= aboveThreshold.size());
+  EXPECT(assert_equal(ample.getLinearizationPoint(),
+                      isam.getLinearizationPoint()));
+}
+
+/* ************************************************************************* */
+TEST(ISAM2, deadline_new_factor)
+{
+  Values fullinit;
+  NonlinearFactorGraph fullgraph;
+  ISAM2Params params(ISAM2GaussNewtonParams(0.0), 0.001, 1000, true);
+  ISAM2 isam = createSlamlikeISAM2(fullinit, fullgraph, params);
+
+  // A new factor on a pose whose relinearization will be deferred
+  boost::optional<Key> pose;
+  for (const VectorValues::KeyValuePair& key_delta : isam.getDelta())
+    if (key_delta.first < 100 &&
+        key_delta.second.lpNorm<Eigen::Infinity>() >= 0.001)
+      pose = key_delta.first;
+  CHECK(pose);
+  NonlinearFactorGraph newFactors;
+  newFactors += PriorFactor<Pose2>(*pose, Pose2(*pose + 0.3, 0.2, 0.1), odoNoise);
+  fullgraph.push_back(newFactors);
+
+  ISAM2UpdateParams updateParams;
+  updateParams.force_relinearize = true;
+  updateParams.deadline = 0.0;
+  ISAM2Result result = isam.update(newFactors, Values(), updateParams);
+  EXPECT(result.deferredRelinKeys.exists(*pose));
+
+  // The new factor is still part of the solution, a Gauss-Newton step from
+  // the linearization point that was kept
+  const Values& theta = isam.getLinearizationPoint();
+  const VectorValues expected = fullgraph.linearize(theta)->optimize();
+  EXPECT(assert_equal(expected, isam.getDelta(), 1e-6));
+  EXPECT(assert_equal(theta.retract(expected), isam.calculateEstimate(), 1e-6));
+}
+
+/* ************************************************************************* */
+TEST(ISAM2, missing_relinearization_threshold)
+{
+  // Thresholds for the poses only, the landmarks have none
+  FastMap<char, Vector> thresholds;
+  thresholds['\0'] = Vector3::Constant(0.001);
+  ISAM2Params params(ISAM2GaussNewtonParams(0.0), thresholds, 1000, true);
+  ISAM2 isam = createSlamlikeISAM2(boost::none, boost::none, params, 0);
+  ISAM2UpdateParams updateParams;
+  updateParams.force_relinearize = true;
+  isam.update(NonlinearFactorGraph(), Values(), updateParams);
+
+  NonlinearFactorGraph newFactors;
+  newFactors += PriorFactor<Point2>(Symbol('l', 0), Point2(1, 2),
+                                    noiseModel::Unit::Create(2));
+  Values newValues;
+  newValues.insert(Symbol('l', 0), Point2(1, 2));
+  CHECK_EXCEPTION(isam.update(newFactors, newValues, updateParams),
+                  std::invalid_argument);
+}
+
 namespace {
   bool checkMarginalizeLeaves(ISAM2& isam, const FastList<Key>& leafKeys) {
     Matrix expectedAugmentedHessian, expected3AugmentedHessian;
@@ -808,6 +920,38 @@ TEST(ISAM2, marginalCovariance)
   EXPECT(assert_equal(expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(ISAM2, marginalCovarianceCached)
+{
+  ISAM2 isam = createSlamlikeISAM2();
+  const Key latest = 11;  // the last pose added by createSlamlikeISAM2
+  const ISAM2Clique::shared_ptr clique = isam[latest];
+  EXPECT(assert_equal(isam.marginalCovariance(latest),
+                      clique->covariance()->block(latest, latest)));
+
+  // A second query reuses the cached covariances
+  const CliqueCovariance::shared_ptr cached = clique->covariance();
+  EXPECT(cached == clique->covariance());
+
+  // After an update, the covariances agree with a batch solution again
+  NonlinearFactorGraph newFactors;
+  newFactors += BetweenFactor<Pose2>(latest, latest + 1, Pose2(1.0, 0.0, 0.0), odoNoise);
+  Values newValues;
+  newValues.insert(latest + 1, isam.calculateEstimate<Pose2>(latest) * Pose2(1.0, 0.0, 0.0));
+  isam.update(newFactors, newValues);
+  const Marginals marginals(isam.getFactorsUnsafe(), isam.getLinearizationPoint());
+  for (Key key : isam.getLinearizationPoint().keys())
+    EXPECT(assert_equal(marginals.marginalCovariance(key),
+                        isam.marginalCovariance(key), 1e-8));
+
+  // Marginalizing a leaf changes a conditional in place
+  isam.marginalizeLeaves(list_of(0));
+  const Marginals reduced(isam.getFactorsUnsafe(), isam.getLinearizationPoint());
+  for (Key key : isam.getLinearizationPoint().keys())
+    EXPECT(assert_equal(reduced.marginalCovariance(key),
+                        isam.marginalCovariance(key), 1e-8));
+}
+
 /* ************************************************************************* */
 TEST(ISAM2, calculate_nnz)
 {
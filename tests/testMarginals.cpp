@@ -124,6 +124,13 @@ TEST(Marginals, planarSLAMmarginals) {
     EXPECT(assert_equal(expectedx3, marginals.marginalCovariance(x3), 1e-8));
     EXPECT(assert_equal(expectedl1, marginals.marginalCovariance(l1), 1e-8));
     EXPECT(assert_equal(expectedl2, marginals.marginalCovariance(l2), 1e-8));
+
+    // All at once
+    const FastMap<Key, Matrix> covariances =
+        marginals.marginalCovariances(KeyVector{x1, x2, x3, l1, l2});
+    EXPECT(assert_equal(expectedx1, covariances.at(x1), 1e-8));
+    EXPECT(assert_equal(expectedx3, covariances.at(x3), 1e-8));
+    EXPECT(assert_equal(expectedl2, covariances.at(l2), 1e-8));
   };
 
   auto testJointMarginals = [&] (Marginals marginals) {
@@ -171,6 +171,11 @@ TEST( NonlinearOptimizer, optimization_method )
 
   Values actualMFChol = LevenbergMarquardtOptimizer(fg, c0, paramsChol).optimize();
   DOUBLES_EQUAL(0,fg.error(actualMFChol),tol);
+
+  LevenbergMarquardtParams paramsSupernodal;
+  paramsSupernodal.linearSolverType = LevenbergMarquardtParams::SUPERNODAL_CHOLESKY;
+  Values actualSupernodal = LevenbergMarquardtOptimizer(fg, c0, paramsSupernodal).optimize();
+  DOUBLES_EQUAL(0,fg.error(actualSupernodal),tol);
 }
 
 /* ************************************************************************* */
@@ -338,6 +343,177 @@ TEST_UNSAFE(NonlinearOptimizer, MoreOptimization) {
   }
 }
 
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, RelinearizeThreshold) {
+  NonlinearFactorGraph fg;
+  fg += PriorFactor<Pose2>(0, Pose2(0, 0, 0),
+      noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(0, 1, Pose2(1, 0, M_PI / 2),
+      noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(1, 2, Pose2(1, 0, M_PI / 2),
+      noiseModel::Isotropic::Sigma(3, 1));
+
+  Values init;
+  init.insert(0, Pose2(0.1, 0.2, 0.1));
+  init.insert(1, Pose2(1.2, 0.3, M_PI / 3));
+  init.insert(2, Pose2(0.9, 1.1, 0.8 * M_PI));
+
+  Values expected;
+  expected.insert(0, Pose2(0, 0, 0));
+  expected.insert(1, Pose2(1, 0, M_PI / 2));
+  expected.insert(2, Pose2(1, 1, M_PI));
+
+  // Re-using linear factors of variables that barely moved still converges
+  LevenbergMarquardtParams lmParams;
+  lmParams.setRelinearizeThreshold(1e-4);
+  EXPECT(assert_equal(expected, LevenbergMarquardtOptimizer(fg, init, lmParams).optimize(), 1e-3));
+
+  GaussNewtonParams gnParams;
+  gnParams.setRelinearizeThreshold(1e-4);
+  EXPECT(assert_equal(expected, GaussNewtonOptimizer(fg, init, gnParams).optimize(), 1e-3));
+
+  DoglegParams dlParams;
+  dlParams.setRelinearizeThreshold(1e-4);
+  EXPECT(assert_equal(expected, DoglegOptimizer(fg, init, dlParams).optimize(), 1e-3));
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, UseArena) {
+  NonlinearFactorGraph fg;
+  fg += PriorFactor<Pose2>(0, Pose2(0, 0, 0),
+      noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(0, 1, Pose2(1, 0, M_PI / 2),
+      noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(1, 2, Pose2(1, 0, M_PI / 2),
+      noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(0, 2, Pose2(1, 1, M_PI),
+      noiseModel::Isotropic::Sigma(3, 1));
+
+  Values init;
+  init.insert(0, Pose2(0.1, 0.2, 0.1));
+  init.insert(1, Pose2(1.2, 0.3, M_PI / 3));
+  init.insert(2, Pose2(0.9, 1.1, 0.8 * M_PI));
+
+  // Allocating the temporaries of each iteration from an arena does not
+  // change the result
+  LevenbergMarquardtParams lmParams;
+  const Values expected = LevenbergMarquardtOptimizer(fg, init, lmParams).optimize();
+  lmParams.setUseArena(true);
+  EXPECT(assert_equal(expected, LevenbergMarquardtOptimizer(fg, init, lmParams).optimize(), 1e-9));
+
+  GaussNewtonParams gnParams;
+  gnParams.setUseArena(true);
+  EXPECT(assert_equal(expected, GaussNewtonOptimizer(fg, init, gnParams).optimize(), 1e-3));
+
+  DoglegParams dlParams;
+  dlParams.setUseArena(true);
+  EXPECT(assert_equal(expected, DoglegOptimizer(fg, init, dlParams).optimize(), 1e-3));
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, ReuseSymbolic) {
+  NonlinearFactorGraph fg;
+  fg += PriorFactor<Pose2>(0, Pose2(0, 0, 0),
+      noiseModel::Isotropic::Sigma(3, 1));
+  for (size_t j = 0; j < 5; ++j)
+    fg += BetweenFactor<Pose2>(j, j + 1, Pose2(1, 0, M_PI / 2),
+        noiseModel::Isotropic::Sigma(3, 1));
+  fg += BetweenFactor<Pose2>(0, 4, Pose2(0, 0, 0),
+      noiseModel::Isotropic::Sigma(3, 1));
+
+  // Perturbed odometry chain
+  Values init;
+  Pose2 pose;
+  for (size_t j = 0; j < 6; ++j) {
+    init.insert(j, pose * Pose2(0.1, -0.05 * j, 0.1));
+    pose = pose * Pose2(1, 0, M_PI / 2);
+  }
+
+  LevenbergMarquardtParams params;
+  const Values expected = LevenbergMarquardtOptimizer(fg, init, params).optimize();
+
+  // Re-using the ordering, or the whole supernodal structure, across
+  // iterations gives the same result
+  params.setReuseSymbolic(true);
+  for (auto type : {LevenbergMarquardtParams::MULTIFRONTAL_CHOLESKY,
+                    LevenbergMarquardtParams::SEQUENTIAL_QR,
+                    LevenbergMarquardtParams::SUPERNODAL_CHOLESKY}) {
+    params.linearSolverType = type;
+    LevenbergMarquardtOptimizer optimizer(fg, init, params);
+    EXPECT(assert_equal(expected, optimizer.optimize(), 1e-6));
+    EXPECT(optimizer.iterations() > 1);
+    EXPECT_DOUBLES_EQUAL(0.0, optimizer.error(), 1e-6);
+  }
+
+  // Damping the assembled Hessian in place, with and without re-using the
+  // symbolic factorization, and with diagonal damping
+  params.setInPlaceDamping(true);
+  for (bool reuse : {false, true}) {
+    params.setReuseSymbolic(reuse);
+    EXPECT(assert_equal(expected, LevenbergMarquardtOptimizer(fg, init, params).optimize(), 1e-6));
+  }
+  LevenbergMarquardtParams ceres = LevenbergMarquardtParams::CeresDefaults();
+  const Values expectedCeres = LevenbergMarquardtOptimizer(fg, init, ceres).optimize();
+  ceres.linearSolverType = LevenbergMarquardtParams::SUPERNODAL_CHOLESKY;
+  ceres.setInPlaceDamping(true);
+  EXPECT(assert_equal(expectedCeres, LevenbergMarquardtOptimizer(fg, init, ceres).optimize(), 1e-6));
+}
+
+/* ************************************************************************* */
+// A pose graph whose Bayes tree, in the ordering {0,1,2,3}, has a merged root
+// clique with a first frontal before that of its child
+static NonlinearFactorGraph createMergedCliqueGraph(Values* init) {
+  NonlinearFactorGraph fg;
+  const SharedNoiseModel model = noiseModel::Isotropic::Sigma(3, 1);
+  for (size_t j = 0; j < 4; ++j) {
+    fg += PriorFactor<Pose2>(j, Pose2(j, 0.5 * j, 0.1 * j), model);
+    init->insert(j, Pose2(j + 0.2, 0.5 * j - 0.1, 0.1 * j + 0.3));
+  }
+  const vector<pair<Key, Key> > edges{{0, 2}, {0, 3}, {1, 2}, {2, 3}};
+  for (const auto& edge : edges)
+    fg += BetweenFactor<Pose2>(edge.first, edge.second,
+                               Pose2(0.8 * (edge.second - edge.first), 0.3, -0.2),
+                               model);
+  return fg;
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, InPlaceDampingMergedCliques) {
+  Values init;
+  const NonlinearFactorGraph fg = createMergedCliqueGraph(&init);
+
+  // Damping in place gives the same steps as buildDampedSystem
+  LevenbergMarquardtParams params;
+  params.ordering = Ordering(KeyVector{0, 1, 2, 3});
+  params.maxIterations = 3;
+  for (bool diagonalDamping : {false, true}) {
+    params.diagonalDamping = diagonalDamping;
+    params.linearSolverType = LevenbergMarquardtParams::MULTIFRONTAL_CHOLESKY;
+    params.setInPlaceDamping(false);
+    const Values expected = LevenbergMarquardtOptimizer(fg, init, params).optimize();
+    params.linearSolverType = LevenbergMarquardtParams::SUPERNODAL_CHOLESKY;
+    params.setInPlaceDamping(true);
+    EXPECT(assert_equal(expected, LevenbergMarquardtOptimizer(fg, init, params).optimize(), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, ReuseSymbolicMergedCliques) {
+  Values init;
+  const NonlinearFactorGraph fg = createMergedCliqueGraph(&init);
+
+  LevenbergMarquardtParams params;
+  params.ordering = Ordering(KeyVector{0, 1, 2, 3});
+  const Values expected = LevenbergMarquardtOptimizer(fg, init, params).optimize();
+
+  // The supernodal structure cached across iterations has a merged root
+  params.linearSolverType = LevenbergMarquardtParams::SUPERNODAL_CHOLESKY;
+  params.setReuseSymbolic(true);
+  LevenbergMarquardtOptimizer optimizer(fg, init, params);
+  EXPECT(assert_equal(expected, optimizer.optimize(), 1e-6));
+  EXPECT(optimizer.iterations() > 1);
+}
+
 /* ************************************************************************* */
 TEST(NonlinearOptimizer, MoreOptimizationWithHuber) {
 
@@ -20,6 +20,8 @@
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/BlockSparseMatrix.h>
+#include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/base/Matrix.h>
@@ -124,6 +126,40 @@ TEST( GaussianFactorGraphSystem, multiply_getb)
   EXPECT(assert_equal(expectedb, actualb, 1e-3));
 }
 
+/* ************************************************************************* */
+// Test BlockSparseSystem::multiply and getb, same as GaussianFactorGraphSystem
+TEST( BlockSparseSystem, multiply_getb)
+{
+  GaussianFactorGraph simpleGFG;
+  SharedDiagonal unit2 = noiseModel::Diagonal::Sigmas(Vector2(0.5, 0.3));
+  simpleGFG += JacobianFactor(2, (Matrix(2,2)<< 10, 0, 0, 10).finished(), (Vector(2) << -1, -1).finished(), unit2);
+  simpleGFG += JacobianFactor(2, (Matrix(2,2)<< -10, 0, 0, -10).finished(), 0, (Matrix(2,2)<< 10, 0, 0, 10).finished(), (Vector(2) << 2, -1).finished(), unit2);
+  simpleGFG += JacobianFactor(2, (Matrix(2,2)<< -5, 0, 0, -5).finished(), 1, (Matrix(2,2)<< 5, 0, 0, 5).finished(), (Vector(2) << 0, 1).finished(), unit2);
+  simpleGFG += JacobianFactor(0, (Matrix(2,2)<< -5, 0, 0, -5).finished(), 1, (Matrix(2,2)<< 5, 0, 0, 5).finished(), (Vector(2) << -1, 1.5).finished(), unit2);
+  simpleGFG += JacobianFactor(0, (Matrix(2,2)<< 1, 0, 0, 1).finished(), (Vector(2) << 0, 0).finished(), unit2);
+  simpleGFG += JacobianFactor(1, (Matrix(2,2)<< 1, 0, 0, 1).finished(), (Vector(2) << 0, 0).finished(), unit2);
+  simpleGFG += JacobianFactor(2, (Matrix(2,2)<< 1, 0, 0, 1).finished(), (Vector(2) << 0, 0).finished(), unit2);
+
+  DummyPreconditioner dummyPreconditioner;
+  KeyInfo keyInfo(simpleGFG);
+  const BlockSparseMatrix hessian(simpleGFG, keyInfo);
+  BlockSparseSystem system(hessian, dummyPreconditioner);
+
+  Vector initial = Vector::Zero(6), residual, preconditionedResidual, p, actualAp;
+  system.residual(initial, residual);
+  system.leftPrecondition(residual, preconditionedResidual);
+  system.rightPrecondition(preconditionedResidual, p);
+  system.multiply(p, actualAp);
+
+  Vector expectedAp = (Vector(6) << 100400, -249074.074, -2080, 148148.148, -146480, 37962.963).finished();
+  EXPECT(assert_equal(expectedAp, actualAp, 1e-3));
+
+  Vector expectedb = (Vector(6) << 100.0, -194.444, -20.0, 138.889, -120.0, -55.556).finished();
+  Vector actualb;
+  system.getb(actualb);
+  EXPECT(assert_equal(expectedb, actualb, 1e-3));
+}
+
 /* ************************************************************************* */
 // Test Dummy Preconditioner
 TEST( PCGSolver, dummy )
@@ -166,6 +202,28 @@ TEST( PCGSolver, blockjacobi )
   DOUBLES_EQUAL(0,fg.error(actualPCG),tol);
 }
 
+/* ************************************************************************* */
+// Test Incomplete Cholesky Preconditioner, with the block sparse kernel
+TEST( PCGSolver, incompleteCholesky )
+{
+  LevenbergMarquardtParams paramsPCG;
+  paramsPCG.linearSolverType = LevenbergMarquardtParams::Iterative;
+  PCGSolverParameters::shared_ptr pcg = boost::make_shared<PCGSolverParameters>();
+  pcg->preconditioner_ = boost::make_shared<IncompleteCholeskyPreconditionerParameters>();
+  pcg->blas_kernel_ = ConjugateGradientParameters::BSR;
+  paramsPCG.iterativeParams = pcg;
+
+  NonlinearFactorGraph fg = example::createReallyNonlinearFactorGraph();
+
+  Point2 x0(10,10);
+  Values c0;
+  c0.insert(X(1), x0);
+
+  Values actualPCG = LevenbergMarquardtOptimizer(fg, c0, paramsPCG).optimize();
+
+  DOUBLES_EQUAL(0,fg.error(actualPCG),tol);
+}
+
 /* ************************************************************************* */
 // Test Incremental Subgraph PCG Solver
 TEST( PCGSolver, subgraph )
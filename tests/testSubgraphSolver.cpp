@@ -29,6 +29,8 @@
 #include <CppUnitLite/TestHarness.h>
 
 #include <boost/assign/std/list.hpp>
+
+#include <algorithm>
 using namespace boost::assign;
 
 using namespace std;
@@ -74,6 +76,70 @@ TEST( SubgraphSolver, splitFactorGraph )
   EXPECT_LONGS_EQUAL(13, Ab2->size());
 }
 
+/* ************************************************************************* */
+TEST( SubgraphBuilder, boruvka )
+{
+  GaussianFactorGraph Ab;
+  VectorValues xtrue;
+  std::tie(Ab, xtrue) = example::planarGraph(5);
+
+  // With equal weights, ties are broken by factor index in both algorithms
+  SubgraphBuilderParameters params;
+  params.augmentationFactor = 0.0;
+  params.skeletonWeight = SubgraphBuilderParameters::EQUAL;
+  params.skeletonType = SubgraphBuilderParameters::KRUSKAL;
+  auto expected = SubgraphBuilder(params)(Ab).edgeIndices();
+  params.skeletonType = SubgraphBuilderParameters::BORUVKA;
+  auto actual = SubgraphBuilder(params)(Ab).edgeIndices();
+  EXPECT_LONGS_EQUAL(1 + 24, actual.size());
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT(expected == actual);
+
+  params.skeletonWeight = SubgraphBuilderParameters::RANDOM;
+  EXPECT_LONGS_EQUAL(1 + 24, SubgraphBuilder(params)(Ab).size());
+  EXPECT(SubgraphBuilderParameters::BORUVKA ==
+         SubgraphBuilderParameters::skeletonTranslator("boruvka"));
+}
+
+/* ************************************************************************* */
+TEST( SubgraphBuilder, update )
+{
+  GaussianFactorGraph Ab;
+  VectorValues xtrue;
+  std::tie(Ab, xtrue) = example::planarGraph(N);
+
+  SubgraphBuilderParameters params;
+  params.augmentationFactor = 0.0;
+  SubgraphBuilder builder(params);
+  const Subgraph subgraph = builder(Ab);
+
+  // Append a new variable, with two measurements
+  using example::impl::key;
+  const size_t numOldFactors = Ab.size();
+  const Matrix2 I = 100 * I_2x2;
+  Ab.emplace_shared<JacobianFactor>(key(3, 1), -I, key(4, 1), I,
+                                    Vector2(100, 0));
+  Ab.emplace_shared<JacobianFactor>(key(3, 2), -I, key(4, 1), I,
+                                    Vector2(100, -100));
+  xtrue.insert(key(4, 1), Vector2(4, 1));
+  EXPECT_DOUBLES_EQUAL(0.0, error(Ab, xtrue), 1e-9);
+
+  // The old subgraph is kept, and one of the new factors joins the tree
+  const Subgraph updated = builder.update(Ab, subgraph, numOldFactors);
+  EXPECT_LONGS_EQUAL(subgraph.size() + 1, updated.size());
+  for (size_t i = 0; i < subgraph.size(); ++i)
+    EXPECT_LONGS_EQUAL(subgraph.edges()[i].index, updated.edges()[i].index);
+  EXPECT(updated.edges().back().index >= numOldFactors);
+
+  SubgraphSolver solver(Ab, updated, kParameters, Ordering::Colamd(Ab));
+  DOUBLES_EQUAL(0.0, error(Ab, solver.optimize()), 1e-5);
+
+  // A subgraph that does not span the new variables is an error
+  Ab.emplace_shared<JacobianFactor>(key(5, 1), I, Vector2(500, 100));
+  CHECK_EXCEPTION(builder.update(Ab, updated, Ab.size()), std::runtime_error);
+}
+
 /* ************************************************************************* */
 TEST( SubgraphSolver, constructor1 )
 {
@@ -11,7 +11,7 @@
 
 /**
  * @file    timeGaussianFactor.cpp
- * @brief   time JacobianFactor.eliminate
+ * @brief   time JacobianFactor.eliminate and updateHessian
  * @author  Alireza Fathi
  */
 
@@ -26,7 +26,9 @@ using namespace std;
 
 #include <gtsam/base/Matrix.h>
 #include <gtsam/linear/JacobianFactor.h>
-#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/Scatter.h>
 #include <gtsam/linear/GaussianConditional.h>
 #include <gtsam/linear/NoiseModel.h>
 
@@ -117,6 +119,31 @@ int main()
   cout << seconds << " seconds" << endl;
   cout << ((double)n/seconds) << " calls/second" << endl;
 
+  // time updateHessian of Pose3-like factors, which use the fixed-size kernels
+  GaussianFactorGraph front;
+  Matrix6 A1, A2;
+  for (int i = 0; i < 6; i++)
+    for (int j = 0; j < 6; j++) {
+      A1(i, j) = sin(1.0 + i + 3.0 * j) + (i == j ? 2.0 : 0.0);
+      A2(i, j) = cos(2.0 * i - j);
+    }
+  const SharedDiagonal between =
+      noiseModel::Diagonal::Sigmas((Vector(6) << 0.1, 0.1, 0.1, 0.3, 0.3, 0.3).finished());
+  for (Key j = 1; j < 20; j++) {
+    front += JacobianFactor(j - 1, A1, j, A2, Vector6::Ones(), between);
+    if (j >= 5) front += JacobianFactor(j - 5, A2, j, A1, Vector6::Ones(), between);
+  }
+  const Scatter scatter(front);
+  int nHessian = 100000;
+  timeLog = clock();
+  for (int i = 0; i < nHessian; i++)
+    HessianFactor combinedHessian(front, scatter);
+  timeLog2 = clock();
+  seconds = (double)(timeLog2-timeLog)/CLOCKS_PER_SEC;
+  cout << "Pose3 updateHessian Timing (" << front.size() << " factors):" << endl;
+  cout << seconds << " seconds" << endl;
+  cout << ((double)nHessian/seconds) << " calls/second" << endl;
+
   // time matrix_augmented
 //  Ordering ordering;
 //  ordering += _x2_, _l1_, _x1_;
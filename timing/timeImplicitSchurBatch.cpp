@@ -0,0 +1,100 @@
+/**
+ * @file    timeImplicitSchurBatch.cpp
+ * @brief   Time Hessian-vector products of many implicit Schur factors, one by
+ *          one versus batched, and the PCG solves using them
+ * @date    Oct 16, 2026
+ */
+
+#include <gtsam/slam/RegularImplicitSchurBatch.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/PinholePose.h>
+#include <gtsam/base/timing.h>
+
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+
+typedef PinholePose<Cal3Bundler> Camera;
+typedef RegularImplicitSchurFactor<Camera> Implicit;
+typedef RegularImplicitSchurBatch<Camera> Batch;
+
+static const int D = Camera::dimension;
+typedef Eigen::Matrix<double, 2, D> Matrix2D;
+
+#define NUM_ITERATIONS 100
+
+/*************************************************************************************/
+// N points, each seen by m of M cameras, with priors on the cameras
+static GaussianFactorGraph createGraph(size_t M, size_t N, size_t m) {
+  GaussianFactorGraph graph;
+  for (size_t j = 0; j < N; j++) {
+    KeyVector keys;
+    vector<Matrix2D, Eigen::aligned_allocator<Matrix2D> > Fblocks;
+    Matrix E(2 * m, 3);
+    for (size_t k = 0; k < m; k++) {
+      keys.push_back((j + 7 * k) % M);
+      Matrix2D F;
+      for (int r = 0; r < 2; r++)
+        for (int c = 0; c < D; c++) F(r, c) = sin(j + 3.0 * k + 5.0 * r + c);
+      Fblocks.push_back(F);
+      for (int r = 0; r < 2; r++)
+        for (int c = 0; c < 3; c++)
+          E(2 * k + r, c) = cos(j + 2.0 * k + r + c) + (r == c ? 2 : 0);
+    }
+    const Matrix3 P = (E.transpose() * E).inverse();
+    graph.push_back(boost::make_shared<Implicit>(keys, Fblocks, E, P,
+                                                 Vector::Ones(2 * m)));
+  }
+  for (size_t i = 0; i < M; i++)
+    graph.emplace_shared<JacobianFactor>(i, Matrix::Identity(D, D),
+                                         Vector::Zero(D));
+  return graph;
+}
+
+/*************************************************************************************/
+int main(void) {
+  const GaussianFactorGraph graph = createGraph(100, 10000, 5);
+  const KeyInfo keyInfo(graph);
+  const map<Key, Vector> lambda;
+  DummyPreconditioner preconditioner;
+
+  Vector x(keyInfo.numCols()), y(keyInfo.numCols());
+  for (DenseIndex i = 0; i < x.size(); i++) x(i) = sin(1.0 + i);
+
+  // Products, factor by factor and batched
+  const GaussianFactorGraphSystem perFactor(graph, preconditioner, keyInfo, lambda);
+  gttic_(multiplyPerFactor);
+  for (size_t t = 0; t < NUM_ITERATIONS; t++) perFactor.multiply(x, y);
+  gttoc_(multiplyPerFactor);
+
+  gttic_(batchCreate);
+  const HessianBatch::shared_ptr batch = Batch::Create(graph);
+  gttoc_(batchCreate);
+  const GaussianFactorGraphSystem batched(graph, preconditioner, keyInfo,
+                                          lambda, batch);
+  gttic_(multiplyBatched);
+  for (size_t t = 0; t < NUM_ITERATIONS; t++) batched.multiply(x, y);
+  gttoc_(multiplyBatched);
+
+  // Complete PCG solves, including creating the batch
+  PCGSolverParameters parameters;
+  parameters.preconditioner_ = boost::make_shared<DummyPreconditionerParameters>();
+  parameters.setMaxIterations(NUM_ITERATIONS);
+  const VectorValues initial = keyInfo.x0();
+  gttic_(pcgPerFactor);
+  PCGSolver(parameters).optimize(graph, keyInfo, lambda, initial);
+  gttoc_(pcgPerFactor);
+
+  parameters.hessianBatch_ = &Batch::Create;
+  gttic_(pcgBatched);
+  PCGSolver(parameters).optimize(graph, keyInfo, lambda, initial);
+  gttoc_(pcgBatched);
+
+  tictoc_print_();
+  return 0;
+}
+
+//*************************************************************************************
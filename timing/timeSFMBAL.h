@@ -35,16 +35,20 @@ using symbol_shorthand::K;
 using symbol_shorthand::P;
 
 static bool gUseSchur = true;
+static bool gUseExplicitSchur = false;
 static SharedNoiseModel gNoiseModel = noiseModel::Unit::Create(2);
 
 // parse options and read BAL file
 SfM_data preamble(int argc, char* argv[]) {
   // primitive argument parsing:
   if (argc > 2) {
-    if (strcmp(argv[1], "--colamd"))
+    if (!strcmp(argv[1], "--colamd"))
       gUseSchur = false;
+    else if (!strcmp(argv[1], "--explicit-schur"))
+      gUseExplicitSchur = true;
     else
-      throw runtime_error("Usage: timeSFMBALxxx [--colamd] [BALfile]");
+      throw runtime_error(
+          "Usage: timeSFMBALxxx [--colamd|--explicit-schur] [BALfile]");
   }
 
   // Load BAL file
@@ -70,7 +74,10 @@ int optimize(const SfM_data& db, const NonlinearFactorGraph& graph,
 //  params.setLinearSolverType("SEQUENTIAL_CHOLESKY");
 //  params.setVerbosityLM("SUMMARY");
 
-  if (gUseSchur) {
+  if (gUseExplicitSchur) {
+    // Eliminate the points in closed form, see SchurComplementSolver
+    params.linearSolverType = NonlinearOptimizerParams::SCHUR_COMPLEMENT;
+  } else if (gUseSchur) {
     // Create Schur-complement ordering
     Ordering ordering;
     for (size_t j = 0; j < db.number_tracks(); j++) ordering.push_back(P(j));